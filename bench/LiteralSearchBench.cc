@@ -0,0 +1,151 @@
+/***************************************************************************************[Solver.cc]
+
+ Sticky Sat -- Copyright (c) 2018-2019, Marc Hartung, Zuse Institute Berlin
+
+Sticky Sat sources are based on Glucose Syrup and is therefore also restricted by all
+copyright notices below.
+
+Sticky Sat sources are based on another copyright. Permissions and copyrights for the parallel
+version of Glucose-Syrup (the "Software") are granted, free of charge, to deal with the Software
+without restriction, including the rights to use, copy, modify, merge, publish, distribute,
+sublicence, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+- The above and below copyrights notices and this permission notice shall be included in all
+copies or substantial portions of the Software;
+
+--------------- Original Glucose Copyrights
+
+ Glucose -- Copyright (c) 2009-2014, Gilles Audemard, Laurent Simon
+ CRIL - Univ. Artois, France
+ LRI  - Univ. Paris Sud, France (2009-2013)
+ Labri - Univ. Bordeaux, France
+
+ Syrup (Glucose Parallel) -- Copyright (c) 2013-2014, Gilles Audemard, Laurent Simon
+ CRIL - Univ. Artois, France
+ Labri - Univ. Bordeaux, France
+
+ Glucose sources are based on MiniSat (see below MiniSat copyrights). Permissions and copyrights of
+ Glucose (sources until 2013, Glucose 3.0, single core) are exactly the same as Minisat on which it
+ is based on. (see below).
+
+ Glucose-Syrup sources are based on another copyright. Permissions and copyrights for the parallel
+ version of Glucose-Syrup (the "Software") are granted, free of charge, to deal with the Software
+ without restriction, including the rights to use, copy, modify, merge, publish, distribute,
+ sublicence, and/or sell copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ - The above and below copyrights notices and this permission notice shall be included in all
+ copies or substantial portions of the Software;
+ - The parallel version of Glucose (all files modified since Glucose 3.0 releases, 2013) cannot
+ be used in any competitive event (sat competitions/evaluations) without the express permission of
+ the authors (Gilles Audemard / Laurent Simon). This is also the case for any competitive event
+ using Glucose Parallel as an embedded SAT engine (single core or not).
+
+
+ --------------- Original Minisat Copyrights
+
+ Copyright (c) 2003-2006, Niklas Een, Niklas Sorensson
+ Copyright (c) 2007-2010, Niklas Sorensson
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ associated documentation files (the "Software"), to deal in the Software without restriction,
+ including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or
+ substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ **************************************************************************************************/
+
+/*
+ * Microbenchmark for the search of a new watched literal in long clauses: compares the scalar
+ * loop with the AVX2 and AVX-512 kernels of LiteralSearch.
+ *
+ * usage: literal_search_bench [clause size] [false fraction] [number of variables]
+ */
+
+#include "shared/LiteralSearch.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+using namespace Sticky;
+
+namespace
+{
+
+struct Instance
+{
+   vec<AssignState> state;
+   vec<Lit> lits;
+   vec<int> offsets;
+};
+
+void createInstance(Instance & inst, const int nVars, const int nClauses, const int clauseSize, const double falseFrac)
+{
+   std::mt19937 rng(42);
+   std::uniform_int_distribution<int> varDist(0, nVars - 1);
+   std::uniform_real_distribution<double> fracDist(0.0, 1.0);
+   inst.state.growTo(nVars);
+   for (int i = 0; i < nVars; ++i)
+      inst.state[i].assign = (fracDist(rng) < 0.5) ? l_True : l_False;
+   for (int i = 0; i < nClauses; ++i)
+   {
+      inst.offsets.push(inst.lits.size());
+      // the leading part of the clause is false, so the search has to skip it
+      const int numFalse = static_cast<int>(falseFrac * clauseSize);
+      for (int j = 0; j < clauseSize; ++j)
+      {
+         const Var v = varDist(rng);
+         if (j < numFalse)
+            inst.lits.push(mkLit(v, inst.state[v].assign == l_True));
+         else
+            inst.lits.push(mkLit(v, fracDist(rng) < 0.5));
+      }
+   }
+}
+
+double run(const char * name, LiteralSearch::Kernel kernel, const Instance & inst, const int clauseSize, const int rounds)
+{
+   long checksum = 0;
+   const auto start = std::chrono::steady_clock::now();
+   for (int r = 0; r < rounds; ++r)
+      for (int i = 0; i < inst.offsets.size(); ++i)
+      {
+         const Lit * c = inst.lits.data() + inst.offsets[i];
+         checksum += kernel(c, 0, clauseSize, inst.state.data(), c[0]);
+      }
+   const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+   const double nsPerSearch = 1e9 * seconds / (static_cast<double>(rounds) * inst.offsets.size());
+   printf("%-8s %8.2f ns/search (checksum %ld)\n", name, nsPerSearch, checksum);
+   return nsPerSearch;
+}
+
+}
+
+int main(int argc, char ** argv)
+{
+   const int clauseSize = (argc > 1) ? atoi(argv[1]) : 32;
+   const double falseFrac = (argc > 2) ? atof(argv[2]) : 0.9;
+   const int nVars = (argc > 3) ? atoi(argv[3]) : 1000000, nClauses = 100000, rounds = 50;
+
+   Instance inst;
+   createInstance(inst, nVars, nClauses, clauseSize, falseFrac);
+   printf("clause size %d, false fraction %.2f, selected kernel: %s\n", clauseSize, falseFrac, LiteralSearch::getKernelName());
+
+   const double scalar = run("scalar", &LiteralSearch::findScalar, inst, clauseSize, rounds);
+   if (LiteralSearch::supportsAvx2())
+      printf("speedup  %8.2f\n", scalar / run("avx2", &LiteralSearch::findAvx2, inst, clauseSize, rounds));
+   if (LiteralSearch::supportsAvx512())
+      printf("speedup  %8.2f\n", scalar / run("avx512", &LiteralSearch::findAvx512, inst, clauseSize, rounds));
+   return 0;
+}
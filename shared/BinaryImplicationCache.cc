@@ -0,0 +1,166 @@
+/***************************************************************************************[Solver.cc]
+
+ Sticky Sat -- Copyright (c) 2018-2019, Marc Hartung, Zuse Institute Berlin
+
+Sticky Sat sources are based on Glucose Syrup and is therefore also restricted by all
+copyright notices below.
+
+Sticky Sat sources are based on another copyright. Permissions and copyrights for the parallel
+version of Glucose-Syrup (the "Software") are granted, free of charge, to deal with the Software
+without restriction, including the rights to use, copy, modify, merge, publish, distribute,
+sublicence, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+- The above and below copyrights notices and this permission notice shall be included in all
+copies or substantial portions of the Software;
+
+--------------- Original Glucose Copyrights
+
+ Glucose -- Copyright (c) 2009-2014, Gilles Audemard, Laurent Simon
+ CRIL - Univ. Artois, France
+ LRI  - Univ. Paris Sud, France (2009-2013)
+ Labri - Univ. Bordeaux, France
+
+ Syrup (Glucose Parallel) -- Copyright (c) 2013-2014, Gilles Audemard, Laurent Simon
+ CRIL - Univ. Artois, France
+ Labri - Univ. Bordeaux, France
+
+ Glucose sources are based on MiniSat (see below MiniSat copyrights). Permissions and copyrights of
+ Glucose (sources until 2013, Glucose 3.0, single core) are exactly the same as Minisat on which it
+ is based on. (see below).
+
+ Glucose-Syrup sources are based on another copyright. Permissions and copyrights for the parallel
+ version of Glucose-Syrup (the "Software") are granted, free of charge, to deal with the Software
+ without restriction, including the rights to use, copy, modify, merge, publish, distribute,
+ sublicence, and/or sell copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ - The above and below copyrights notices and this permission notice shall be included in all
+ copies or substantial portions of the Software;
+ - The parallel version of Glucose (all files modified since Glucose 3.0 releases, 2013) cannot
+ be used in any competitive event (sat competitions/evaluations) without the express permission of
+ the authors (Gilles Audemard / Laurent Simon). This is also the case for any competitive event
+ using Glucose Parallel as an embedded SAT engine (single core or not).
+
+
+ --------------- Original Minisat Copyrights
+
+ Copyright (c) 2003-2006, Niklas Een, Niklas Sorensson
+ Copyright (c) 2007-2010, Niklas Sorensson
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ associated documentation files (the "Software"), to deal in the Software without restriction,
+ including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or
+ substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ **************************************************************************************************/
+
+#include "shared/BinaryImplicationCache.h"
+#include "shared/ClauseWatcher.h"
+
+namespace Sticky
+{
+
+BinaryImplicationCache::BinaryImplicationCache(const int numLits, const int maxImplications)
+      : numLits(numLits),
+        maxImplications(maxImplications),
+        round(1),
+        visitStamp(0),
+        table(),
+        arena(),
+        visited(),
+        result()
+{
+}
+
+const vec<Lit> & BinaryImplicationCache::getImplications(const BinaryWatcherLists & binWatched, const Lit p)
+{
+   result.clear();
+   if (maxImplications <= 0)
+      return result;
+   if (table.size() == 0)
+   {
+      table.growTo(TableSize, Entry { 0, 0, 0, 0 });
+      visited.growTo(numLits, 0);
+   }
+
+   // look for p or a free entry in the few entries after its hash position
+   const int key = toInt(p);
+   Entry * free = nullptr;
+   for (int i = 0; i < MaxProbes; ++i)
+   {
+      Entry & e = table[(static_cast<uint32_t>(key) * 2654435761u + i) & (TableSize - 1)];
+      if (e.round != round)
+      {
+         free = &e;
+         break;
+      } else if (e.lit == key)
+      {
+         for (int j = 0; j < e.size; ++j)
+            result.push(arena[e.begin + j]);
+         return result;
+      }
+   }
+
+   computeImplications(binWatched, p, result);
+   // the arena holds the results of at most half the table
+   if (free != nullptr && arena.size() + result.size() <= TableSize / 2 * maxImplications)
+   {
+      *free = Entry { round, key, arena.size(), result.size() };
+      for (int j = 0; j < result.size(); ++j)
+         arena.push(result[j]);
+   }
+   return result;
+}
+
+void BinaryImplicationCache::clear()
+{
+   arena.clear();
+   ++round;
+   if (round == 0)
+   {
+      for (int i = 0; i < table.size(); ++i)
+         table[i].round = 0;
+      round = 1;
+   }
+}
+
+void BinaryImplicationCache::computeImplications(const BinaryWatcherLists & binWatched, const Lit p, vec<Lit> & out)
+{
+   out.clear();
+   if (++visitStamp == 0)
+   {
+      for (int i = 0; i < visited.size(); ++i)
+         visited[i] = 0;
+      visitStamp = 1;
+   }
+   visited[toInt(p)] = visitStamp;
+   // out is the queue of the breadth first search as well
+   Lit from = p;
+   for (int i = 0; out.size() < maxImplications; from = out[i++])
+   {
+      const vec<BinaryWatcher> & ws = binWatched.getWatcher(from);
+      for (int j = 0; j < ws.size() && out.size() < maxImplications; ++j)
+      {
+         const Lit imp = ws[j].getBlocker();
+         if (visited[toInt(imp)] != visitStamp)
+         {
+            visited[toInt(imp)] = visitStamp;
+            out.push(imp);
+         }
+      }
+      if (i == out.size())
+         break;
+   }
+}
+
+} /* namespace Sticky */
@@ -0,0 +1,125 @@
+/***************************************************************************************[Solver.cc]
+
+ Sticky Sat -- Copyright (c) 2018-2019, Marc Hartung, Zuse Institute Berlin
+
+Sticky Sat sources are based on Glucose Syrup and is therefore also restricted by all
+copyright notices below.
+
+Sticky Sat sources are based on another copyright. Permissions and copyrights for the parallel
+version of Glucose-Syrup (the "Software") are granted, free of charge, to deal with the Software
+without restriction, including the rights to use, copy, modify, merge, publish, distribute,
+sublicence, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+- The above and below copyrights notices and this permission notice shall be included in all
+copies or substantial portions of the Software;
+
+--------------- Original Glucose Copyrights
+
+ Glucose -- Copyright (c) 2009-2014, Gilles Audemard, Laurent Simon
+ CRIL - Univ. Artois, France
+ LRI  - Univ. Paris Sud, France (2009-2013)
+ Labri - Univ. Bordeaux, France
+
+ Syrup (Glucose Parallel) -- Copyright (c) 2013-2014, Gilles Audemard, Laurent Simon
+ CRIL - Univ. Artois, France
+ Labri - Univ. Bordeaux, France
+
+ Glucose sources are based on MiniSat (see below MiniSat copyrights). Permissions and copyrights of
+ Glucose (sources until 2013, Glucose 3.0, single core) are exactly the same as Minisat on which it
+ is based on. (see below).
+
+ Glucose-Syrup sources are based on another copyright. Permissions and copyrights for the parallel
+ version of Glucose-Syrup (the "Software") are granted, free of charge, to deal with the Software
+ without restriction, including the rights to use, copy, modify, merge, publish, distribute,
+ sublicence, and/or sell copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ - The above and below copyrights notices and this permission notice shall be included in all
+ copies or substantial portions of the Software;
+ - The parallel version of Glucose (all files modified since Glucose 3.0 releases, 2013) cannot
+ be used in any competitive event (sat competitions/evaluations) without the express permission of
+ the authors (Gilles Audemard / Laurent Simon). This is also the case for any competitive event
+ using Glucose Parallel as an embedded SAT engine (single core or not).
+
+
+ --------------- Original Minisat Copyrights
+
+ Copyright (c) 2003-2006, Niklas Een, Niklas Sorensson
+ Copyright (c) 2007-2010, Niklas Sorensson
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ associated documentation files (the "Software"), to deal in the Software without restriction,
+ including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or
+ substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ **************************************************************************************************/
+
+#ifndef SHARED_BINARYIMPLICATIONCACHE_H_
+#define SHARED_BINARYIMPLICATIONCACHE_H_
+
+#include "shared/SharedTypes.h"
+
+namespace Sticky
+{
+
+class BinaryWatcherLists;
+
+/*
+ * Literals that are transitively implied by a literal through binary clauses. The implications of
+ * a literal are computed once by a bounded breadth first search and are reused until the cache is
+ * cleared. Binary clauses are never weakened, so older entries stay valid, they only miss
+ * implications of binaries added later. The solver clears the cache on restarts.
+ *
+ * The results are kept in a hash table of TableSize entries pointing into one arena of literals,
+ * both are reset by clear(). So the memory of the cache is bounded independent of the number of
+ * variables. Results that do not fit into the table are computed again on each request. Nothing is
+ * allocated before the first request, and never when maxImplications is 0.
+ */
+class BinaryImplicationCache
+{
+ public:
+   BinaryImplicationCache(const int numLits, const int maxImplications);
+
+   // returns at most maxImplications literals implied by p, p itself is not contained, the result is
+   // valid until the next call
+   const vec<Lit> & getImplications(const BinaryWatcherLists & binWatched, const Lit p);
+
+   void clear();
+
+ private:
+   static const int TableSize = 1 << 12;  // has to be a power of two
+   static const int MaxProbes = 8;
+
+   struct Entry
+   {
+      uint32_t round;
+      int lit;
+      int begin;
+      int size;
+   };
+
+   int numLits;
+   int maxImplications;
+   uint32_t round;
+   uint32_t visitStamp;
+   vec<Entry> table;
+   vec<Lit> arena;
+   vec<uint32_t> visited;
+   vec<Lit> result;
+
+   void computeImplications(const BinaryWatcherLists & binWatched, const Lit p, vec<Lit> & out);
+};
+
+} /* namespace Sticky */
+
+#endif /* SHARED_BINARYIMPLICATIONCACHE_H_ */
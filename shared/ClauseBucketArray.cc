@@ -71,6 +71,7 @@ copies or substantial portions of the Software;
 #include "shared/SharedTypes.h"
 #include "shared/ClauseTypes.h"
 
+#include <chrono>
 #include <iostream>
 #include <memory>
 #include <set>
@@ -315,7 +316,6 @@ void ClauseBucketArray::simpleRemoveClause(CoreSolver & ts, const CRef & cref)
    if (c.isSharedClause() || c.isPermanentClause())
    {
       SharedClause & rc = c.shared();
-      unsigned numRefs1 = rc.getNumRefs();
 //      std::cout << ts.getThreadId() << " '" << cref << "' r" << numRefs1 << "\n";
 //      std::cout.flush();
 //      if (numRefs1 == 0 && isValidRef(rc.getReplaceCRef()))
@@ -325,8 +325,6 @@ void ClauseBucketArray::simpleRemoveClause(CoreSolver & ts, const CRef & cref)
 //         std::cout.flush();
 //      }
       auto refChange = rc.dereference(cref);
-      unsigned numRefs2 = refChange.refs();
-      assert(numRefs1 > numRefs2);
       shouldRemove = refChange.isDereferenced();
 //      std::cout << ts.getThreadId() << " cref " << cref << " dereferenced (" << refChange.refs() << ")\n";
 //      std::cout.flush();
@@ -412,21 +410,36 @@ void ClauseBucketArray::removeLater(CoreSolver & ts, const CRef & startCRef, con
    ts.getThreadState().deleteRefs.push( std::make_tuple( startCRef, endCRef));
 }
 
+// Releases the clauses the solver gave up since the last collection. The order of the releases
+// does not matter, so when the pause limit is reached the remaining ones are left for the next call.
 void ClauseBucketArray::garbageCollection(CoreSolver & ts)
 {
+   typedef std::chrono::steady_clock Clock;
    vec<std::tuple<CRef, CRef>> & dels = ts.getThreadState().deleteRefs;
-   for (int i = 0; i < dels.size(); ++i)
+   if (dels.size() == 0)
+      return;
+   const Clock::time_point start = Clock::now();
+   const uint64_t maxMicros = heuristic.maxGcPauseMicros;
+   for (unsigned n = 1; dels.size() > 0; ++n)
    {
-      if (getClause(std::get<0>(dels[i])).isPrivateClause())
+      const CRef first = std::get<0>(dels.last()), last = std::get<1>(dels.last());
+      dels.pop();
+      if (getClause(first).isPrivateClause())
       {
-         assert(std::get<1>(dels[i]) == CRef_Undef);
-         simpleRemoveClause(ts, std::get<0>(dels[i]));
+         assert(last == CRef_Undef);
+         simpleRemoveClause(ts, first);
       } else
-      {
-         recursiveRemove(ts, std::get<0>(dels[i]), std::get<1>(dels[i]));
-      }
+         recursiveRemove(ts, first, last);
+      // the clock is only read every few releases
+      if (maxMicros > 0 && (n & 63) == 0
+            && static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count()) >= maxMicros)
+         break;
    }
-   dels.clear();
+   const uint64_t micros = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+   SolverStatistic & stat = ts.getStatistic();
+   stat.gcMicros += micros;
+   if (micros > stat.maxGcMicros)
+      stat.maxGcMicros = micros;
 }
 
 }
@@ -77,7 +77,9 @@ namespace Sticky
 {
 
 ClauseDatabase::ClauseDatabase()
-      : completeViviInProgress(0),
+      : walkPhases(),
+        walkFalsified(std::numeric_limits<int>::max()),
+        completeViviInProgress(0),
         abortSolving(false),
         numRunningThreads(0),
         finishedSolver(nullptr),
@@ -92,11 +94,13 @@ ClauseDatabase::ClauseDatabase()
 {
    assert(buckets.getHeuristic().numThreads > 0);
    pthread_barrier_init(&startVivBarrier, 0, buckets.getHeuristic().numThreads);
+   pthread_mutex_init(&walkMutex, NULL);
 }
 
 ClauseDatabase::~ClauseDatabase()
 {
    pthread_barrier_destroy(&startVivBarrier);
+   pthread_mutex_destroy(&walkMutex);
 }
 
 void ClauseDatabase::setLbd(CoreSolver & s, const VarSet & vs, const unsigned lbd)
@@ -165,8 +169,7 @@ CRef ClauseDatabase::getCRef(const CoreSolver & s, const VarSet & w) const
    CRef res = CRef_Undef;
    switch (w.getWatcherType())
    {
-      case WatcherType::BINARY:
-         res = s.getThreadState().binWatched.getCRef(w);
+      case WatcherType::BINARY:  // binary clauses have no reference
          break;
       case WatcherType::ONE:
          res = s.getThreadState().oneWatched.getCRef(w);
@@ -249,6 +252,8 @@ void ClauseDatabase::reduce(CoreSolver & s)
 {
    ClauseReducer cred(*this, buckets, s);
    cred.reduce();
+   s.getThreadState().recentCRefs.clear();
+   s.getThreadState().recentPos = 0;
    setBudgetTillNextReduce(s);
 }
 
@@ -282,21 +287,74 @@ VarSet ClauseDatabase::addClause(CoreSolver & s, const vec<Lit> & c, const unsig
          ++s.getStatistic().nPrivateCl;
          --s.getStatistic().nExportedCl;
       }
-      BaseClause & c = buckets.getClause(cref);
-      if (c.size() > 2)
+      subsumeRecentClauses(s, c, cref);
+      BaseClause & cl = buckets.getClause(cref);
+      if (cl.size() > 2)
       {
          res = s.getThreadState().twoWatched.attachOnFirst(cref, s, lbd);
       } else
       {
-         assert(c.size() == 2);
-         auto tmp = s.getThreadState().binWatched.attach(cref, s);
+         assert(cl.size() == 2);
+         auto tmp = s.getThreadState().binWatched.attach(c[0], c[1], s);
          assert(!tmp.isConflict());
          res = tmp.getVarSet();
+         // the clause was only allocated to share it, this solver keeps the binary in its watch lists
+         assert(cl.isPermanentClause());
+         buckets.removeClause(s, cref);
       }
    }
    return res;
 }
 
+// Marks the last private learnt clauses of this thread that contain all literals of the new clause
+// c as deleted. They are removed by the next reduce. Afterwards c itself is remembered when private.
+void ClauseDatabase::subsumeRecentClauses(CoreSolver & s, const vec<Lit> & c, const CRef cref)
+{
+   DatabaseThreadState & ts = s.getThreadState();
+   const unsigned maxRecent = sharingHeuristic.numRecentSubsumption;
+   if (maxRecent == 0)
+      return;
+   if (++ts.litStamp == 0)
+   {
+      for (int i = 0; i < ts.litStamps.size(); ++i)
+         ts.litStamps[i] = 0;
+      ts.litStamp = 1;
+   }
+   for (int i = 0; i < c.size(); ++i)
+      ts.litStamps[toInt(c[i])] = ts.litStamp;
+
+   for (int i = 0; i < ts.recentCRefs.size(); ++i)
+   {
+      const CRef recent = ts.recentCRefs[i];
+      if (recent == CRef_Undef)
+         continue;
+      const BaseClause & rc = buckets.getClause(recent);
+      if (rc.size() < c.size() || !rc.isPrivateClause() || rc.isPrivDel() || rc.isReplaced())
+         continue;
+      int numFound = 0;
+      for (int j = 0; j < rc.size(); ++j)
+         numFound += ts.litStamps[toInt(rc[j])] == ts.litStamp;
+      if (numFound == c.size())
+      {
+         buckets.markClauseAsDeleted(recent);
+         ts.recentCRefs[i] = CRef_Undef;
+         ++s.getStatistic().nRecentSubsumed;
+      }
+   }
+
+   const BaseClause & cl = buckets.getClause(cref);
+   if (cl.isPrivateClause() && cl.size() <= sharingHeuristic.maxRecentSubsumptionSize)
+   {
+      if (static_cast<unsigned>(ts.recentCRefs.size()) < maxRecent)
+         ts.recentCRefs.push(cref);
+      else
+      {
+         ts.recentCRefs[ts.recentPos] = cref;
+         ts.recentPos = (ts.recentPos + 1) % maxRecent;
+      }
+   }
+}
+
 CRef ClauseDatabase::addInitialClause(const Glucose::Clause & c)
 {
    assert(c.size() > 1);
@@ -304,16 +362,18 @@ CRef ClauseDatabase::addInitialClause(const Glucose::Clause & c)
    return cref;
 }
 
-void ClauseDatabase::notifyClauseUsedInConflict(CoreSolver & s, VarSet & vs)
+// nblevels is the current LBD of the clause, it is counted by the conflict analysis.
+void ClauseDatabase::notifyClauseUsedInConflict(CoreSolver & s, VarSet & vs, const unsigned nblevels)
 {
+   if (vs.getWatcherType() == WatcherType::BINARY)
+      return;  // binaries are permanent and have no activity or lbd to update
    bool shouldbeVivi = false;
    BaseClause & c = getClause(s, vs);
-   unsigned nblevels = c.getLbd();
    if (vs.getWatcherType() == WatcherType::ONE)
    {
       DatabaseThreadState & ts = s.getThreadState();
       VarSet tmp = vs;
-      vs = ts.twoWatched.attachOneWatched(ts.oneWatched.getWatcher(vs), s, vs.getWatchedLit(), nblevels);
+      vs = ts.twoWatched.attachOneWatched(ts.oneWatched.getWatcher(vs), s, vs.getWatchedLit(), c.getLbd());
       ts.oneWatched.detach(s, tmp);
       ++s.getStatistic().nPromotedCl;
    }
@@ -321,7 +381,6 @@ void ClauseDatabase::notifyClauseUsedInConflict(CoreSolver & s, VarSet & vs)
    {
       increaseActivity(s, vs);
       // DYNAMIC NBLEVEL trick (see competition'09 companion paper)
-      nblevels = s.computeLBD(c);
       if (nblevels < c.getLbd())
       {
          updateLBD(s, vs, nblevels);  // improve the LBD
@@ -370,7 +429,7 @@ void ClauseDatabase::importCRefs(CoreSolver & s)
                //std::string str;
                wasAttached = false;
                const BaseClause & c = buckets.getClause(cref);
-               if (!c.isPermanentClause())
+               if (!c.isPermanentClause() && c.size() > 2)
                {
                   assert(c.size() > 2);
                   assert(!c.isPrivateClause());
@@ -392,13 +451,15 @@ void ClauseDatabase::importCRefs(CoreSolver & s)
                {
                   if (c.size() == 2)
                   {
-                     confl = ts.binWatched.attach(cref, s);
+                     const Lit a = c[0], b = c[1];
+                     confl = ts.binWatched.attach(a, b, s);
+                     // the binary is now kept in the watch lists, so release this solver's reference
+                     buckets.removeClause(s, cref);
 //                     std::cout << s.getThreadId() << " imported '" << cref << "'\n";
 //                     std::cout.flush();
-                     assert(getCRef(s, confl.getVarSet()) == cref);
                      if (confl.isConflict())
                      {
-                        Lit minLvlLit = (ls.level(c[0]) < ls.level(c[1])) ? c[0] : c[1], maxLvlLit = (minLvlLit == c[0]) ? c[1] : c[0];
+                        Lit minLvlLit = (ls.level(a) < ls.level(b)) ? a : b, maxLvlLit = (minLvlLit == a) ? b : a;
                         int minLvl = ls.level(minLvlLit), maxLvl = ls.level(maxLvlLit);
                         if (maxLvl == 0)
                            s.setResult(l_False, "Conflict through clause import");
@@ -408,8 +469,9 @@ void ClauseDatabase::importCRefs(CoreSolver & s)
                         {
                            s.cancelUntil(ls.level(minLvlLit));
                            assert(ls.value(minLvlLit) == l_False && ls.value(maxLvlLit) == l_Undef);
-                           confl.getVarSet().setPropagated(WatcherType::BINARY);
-                           s.uncheckedEnqueue(maxLvlLit, confl.getVarSet());
+                           const vec<BinaryWatcher> & ws = ts.binWatched.getWatcher(~minLvlLit);
+                           assert(ws.last().getBlocker() == maxLvlLit);
+                           s.uncheckedEnqueue(maxLvlLit, minLvl, VarSet(ws.last(), ts.binWatched.getIndex(~minLvlLit), ws.size() - 1));
                         }
                      }
                   } else
@@ -518,6 +580,7 @@ void ClauseDatabase::notifyNewConflict(CoreSolver & s)
 void ClauseDatabase::notifyRestart(CoreSolver & s)
 {
    assert(s.getLiteralSetting().decisionLevel() == 0);
+   s.strengthenOtfsClauses();  // the remembered references are only valid until the next reduce
    checkCompleteVivification(s, false);
    if (shouldReduce(s))
    {
@@ -530,12 +593,31 @@ void ClauseDatabase::notifyRestart(CoreSolver & s)
       //         std::cout << s.getThreadId() << " end:\n";
       //         std::cout.flush();
       ++s.getStatistic().nReduces;
+   } else if (s.getThreadState().deleteRefs.size() > 0)
+   {
+      // continue a garbage collection that ran out of time, the recent clauses may be released by it
+      s.getThreadState().recentCRefs.clear();
+      s.getThreadState().recentPos = 0;
+      buckets.garbageCollection(s);
    }
 
    importCRefs(s);  // always import clauses after reduce
    importUnits(s);
 }
 
+void ClauseDatabase::notifyPartialRestart(CoreSolver & s)
+{
+   assert(!needsRootRestart(s));
+   importCRefs(s);
+   importUnits(s);
+}
+
+bool ClauseDatabase::needsRootRestart(const CoreSolver & s) const
+{
+   const DatabaseThreadState & state = s.getThreadState();
+   return (completeViviRefs.size() > 0 && completeViviInProgress == 2) || s.getStatistic().nConflicts >= state.restartFactor * state.nConflictsBeforeReduce;
+}
+
 void ClauseDatabase::notifySolverStart(CoreSolver & s)
 {
    ++numRunningThreads;
@@ -639,6 +721,27 @@ bool ClauseDatabase::foundSolution(CoreSolver & s, lbool result, const std::stri
    return res;
 }
 
+void ClauseDatabase::publishWalkPhases(const vec<char> & phases, const int numFalsified)
+{
+   pthread_mutex_lock(&walkMutex);
+   if (numFalsified <= walkFalsified)
+   {
+      phases.copyTo(walkPhases);
+      walkFalsified = numFalsified;
+   }
+   pthread_mutex_unlock(&walkMutex);
+}
+
+bool ClauseDatabase::getWalkPhases(vec<char> & phases)
+{
+   pthread_mutex_lock(&walkMutex);
+   const bool res = walkPhases.size() > 0;
+   if (res)
+      walkPhases.copyTo(phases);
+   pthread_mutex_unlock(&walkMutex);
+   return res;
+}
+
 lbool ClauseDatabase::getResult() const
 {
    assert(jobFinished());
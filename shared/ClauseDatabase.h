@@ -149,9 +149,11 @@ class ClauseDatabase
    // Notifiers:
    void notifySolverStart(CoreSolver & s);
    void notifySolverEnd(CoreSolver & s);
-   void notifyClauseUsedInConflict(CoreSolver & s, VarSet & vs);
+   void notifyClauseUsedInConflict(CoreSolver & s, VarSet & vs, const unsigned nblevels);
    void notifyNewConflict(CoreSolver & s);
    void notifyRestart(CoreSolver & s);
+   void notifyPartialRestart(CoreSolver & s);
+   bool needsRootRestart(const CoreSolver & s) const;  // reduce or vivification is pending at the next restart
 
    void importUnits(CoreSolver & s);
    void importCRefs(CoreSolver & s);
@@ -170,8 +172,17 @@ class ClauseDatabase
 
    SWriterMReaderVec<CRef> & getCompleteViviRefs();
 
+   // Best phases of the local search workers, they replace the published ones when they falsify
+   // at most as many clauses
+   void publishWalkPhases(const vec<char> & phases, const int numFalsified);
+   bool getWalkPhases(vec<char> & phases);
+
  private:
 
+   pthread_mutex_t walkMutex;
+   vec<char> walkPhases;
+   int walkFalsified;
+
    std::atomic<unsigned> completeViviInProgress;
    SWriterMReaderVec<CRef> completeViviRefs;
 
@@ -197,6 +208,7 @@ class ClauseDatabase
  private:
 
    void updateLBD(CoreSolver & s, VarSet & vs, const unsigned lbd);
+   void subsumeRecentClauses(CoreSolver & s, const vec<Lit> & c, const CRef cref);
    bool tryShareClause(CoreSolver & s, VarSet & vs);
 
    bool shouldReduce(const CoreSolver & s) const;
@@ -260,9 +272,12 @@ bool ClauseDatabase::replaceClause(CoreSolver & s, const CRef cref, const VarSet
          if (buckets.getClause(newRef).size() == 2)
          {
             assert(buckets.getClause(cref).size() > newC.size());
+            const BaseClause & bin = buckets.getClause(newRef);
             two.detach(s, wpos);
-            s.getThreadState().binWatched.attach(newRef, s);
-
+            s.getThreadState().binWatched.attach(bin[0], bin[1], s);
+            // the binary lives in the watch lists only, other solvers get it through the replace chain or the reference sharer
+            assert(bin.isPermanentClause());
+            buckets.removeClause(s, newRef);
          } else
          {
             const Watcher & w = two.getWatcher(wpos);
@@ -285,7 +300,7 @@ bool ClauseDatabase::replaceClause(CoreSolver & s, const CRef cref, const VarSet
          --s.getStatistic().nPrivateCl;
       else if (oldC.isSharedClause())
          --s.getStatistic().nSharedCl;
-      if (isValidRef(newRef) && buckets.getClause(newRef).isSharedClause())
+      if (isValidRef(newRef) && newC.size() > 2 && buckets.getClause(newRef).isSharedClause())
          ++s.getStatistic().nSharedCl;
    }
    return res;
@@ -404,9 +419,7 @@ inline const BaseClause & ClauseDatabase::getClause(const CoreSolver & s, const
          return buckets.getClause(s.getThreadState().oneWatched.getCRef(vs));
       case WatcherType::TWO:
          return buckets.getClause(s.getThreadState().twoWatched.getCRef(vs));
-      case WatcherType::BINARY:
-         return buckets.getClause(s.getThreadState().binWatched.getCRef(vs));
-      default:
+      default:  // binary clauses are not stored in the buckets
          assert(false);
          return *(reinterpret_cast<const BaseClause*>(0));
    }
@@ -420,9 +433,7 @@ inline BaseClause & ClauseDatabase::getClause(const CoreSolver & s, const VarSet
          return buckets.getClause(s.getThreadState().oneWatched.getCRef(vs));
       case WatcherType::TWO:
          return buckets.getClause(s.getThreadState().twoWatched.getCRef(vs));
-      case WatcherType::BINARY:
-         return buckets.getClause(s.getThreadState().binWatched.getCRef(vs));
-      default:
+      default:  // binary clauses are not stored in the buckets
          assert(false);
          return *(reinterpret_cast<BaseClause*>(0));
    }
@@ -69,6 +69,9 @@ copies or substantial portions of the Software;
 #include "shared/ClauseWatcher.h"
 #include "shared/SharedTypes.h"
 
+#include <algorithm>
+#include <limits>
+
 namespace Sticky
 {
 
@@ -128,15 +131,11 @@ void ClauseReducer::cleanBinaryWatched()
       for (int k = 0; k < ws.size(); ++k)
       {
          const BinaryWatcher & w = ws[k];
-         BaseClause & c = cba.getClause(w.getCRef());
-         assert(c.contains(~cur));
          if (curTrue || ls.value(w.getBlocker()) == l_True)
          {
+            // the clause is only stored in the two watch lists, so count it once
             if (toInt(w.getBlocker()) < i)
-            {
-               cba.removeClause(s, w.getCRef());
                --s.getStatistic().nTwoWatchedClauses;
-            }
          } else
             ws[j++] = ws[k];
       }
@@ -403,7 +402,7 @@ void ClauseReducer::collectPrivateGoodClauses(vec<CRef> & crefs)
 {
    vec<TwoRef> refs;
    int numRelevant = 0;
-   for (int i = 0; i < two.size(); ++i)
+   for (int i = two.nextOccupied(0); i < two.size(); i = two.nextOccupied(i + 1))
    {
       vec<Watcher> & ws = two.getWatcher(i);
       for (int j = 0; j < ws.size(); ++j)
@@ -466,91 +465,75 @@ void ClauseReducer::collectPrivateGoodClauses(vec<CRef> & crefs)
    }
 }
 
+// Key of a reduce candidate, larger keys are removed first. The clause is only dereferenced once
+// to build the key, the selection then works on the compact array.
+struct ReduceRef
+{
+   uint64_t key;
+   int listPos;
+   int wPos;
+};
+
+static inline bool worseReduceRef(const ReduceRef & a, const ReduceRef & b)
+{
+   return a.key > b.key;
+}
+
+// Learnt clauses are split in three tiers by their lbd: core clauses are kept, tier-2 clauses are
+// kept while they are used between two reduces and the local clauses are reduced. Unused tier-2
+// clauses join the local ones. The removed clauses are selected with nth_element instead of a
+// complete sort.
+//
 int ClauseReducer::reduceTwoWatched()
 {
-   vec<TwoRef> refs;
+   const SolverHeuristic & h = s.getHeuristic();
+   vec<ReduceRef> refs;
 // first collect references to clauses, and update clauses by reallocation, new versions or deletions
-   if (s.getHeuristic().chanseok)
+   for (int i = two.nextOccupied(0); i < two.size(); i = two.nextOccupied(i + 1))
    {
-      for (int i = 0; i < two.size(); ++i)
+      vec<Watcher> &ws = two.getWatcher(i);
+      for (int j = 0; j < ws.size(); ++j)
       {
-         vec<Watcher> &ws = two.getWatcher(i);
-         for (int j = 0; j < ws.size(); ++j)
+         Watcher & w = ws[j];
+         if (!w.isHeader() || w.getLbd() <= h.coreLbd || cba.shouldBeRemoved(w.getCRef()) || cba.shouldBeReplaced(w.getCRef()))
+            continue;
+         const BaseClause & c = db.getClause(w);
+         if (c.isPermanentClause())
+            continue;
+         const bool used = w.isUsed();
+         w.resetUsed();
+         const uint64_t inactivity = std::numeric_limits<uint16_t>::max() - w.getActivity();
+         if (h.chanseok)
          {
-            Watcher & w = ws[j];
-            if (w.isHeader())
-            {
-               BaseClause & c = db.getClause(w);
-               if (!cba.shouldBeRemoved(w.getCRef()) && !cba.shouldBeReplaced(w.getCRef())
-                     && !c.isPermanentClause())
-               {
-                  if (w.getLbd() > 2 && (w.getActivity() > 0 || w.getLbd() > 4))
-                     refs.push( { i, j });
-               }
-            }
-         }
-      }
-
-      // sort 'bad' clause references ones to the beginning:
-      sort(refs,
-           [this](const TwoRef & v1, const TwoRef &v2)
-           {
-              const Watcher & w1 = two.getWatcher(v1.listPos,v1.wPos), & w2 = two.getWatcher(v2.listPos,v2.wPos);
-              return w1.getActivity() < w2.getActivity();
-           });
-
-   } else
-   {
-      for (int i = 0; i < two.size(); ++i)
-      {
-         vec<Watcher> &ws = two.getWatcher(i);
-         for (int j = 0; j < ws.size(); ++j)
+            // unused clauses of a small lbd are kept until they become active
+            if (w.getActivity() > 0 || w.getLbd() > 4)
+               refs.push( { inactivity, i, j });
+         } else if (w.getLbd() > h.tier2Lbd || !used)
          {
-            Watcher & w = ws[j];
-            if (w.isHeader())
-            {
-               BaseClause & c = db.getClause(w);
-               if (!cba.shouldBeRemoved(w.getCRef()) && !cba.shouldBeReplaced(w.getCRef())
-                     && !c.isPermanentClause())
-               {
-                  if (w.getLbd() > 2)
-                     refs.push( { i, j });
-               }
-            }
+            const uint64_t size = std::min<uint64_t>(c.size(), std::numeric_limits<uint32_t>::max());
+            refs.push( { (static_cast<uint64_t>(w.getLbd()) << 48) | (inactivity << 32) | size, i, j });
          }
       }
-
-      // sort 'bad' clause references ones to the beginning:
-      sort(refs,
-           [this](const TwoRef & v1, const TwoRef &v2)
-           {
-              const Watcher & w1 = two.getWatcher(v1.listPos,v1.wPos), & w2 = two.getWatcher(v2.listPos,v2.wPos);
-              unsigned tmp1 = w1.getLbd(), tmp2 = w2.getLbd();
-              if(tmp1 == tmp2)
-              {
-                 tmp1 = w1.getActivity(); tmp2 = w2.getActivity();
-                 if(tmp1 == tmp2)
-                 return cba.getClause(w1.getCRef()).size() > cba.getClause(w2.getCRef()).size();  // size compare
-                 else
-                 return tmp1 < tmp2;// activity compare
-              }
-              else
-              return tmp1 > tmp2;  // lbd compare
-           });
    }
-   int mid = refs.size() / 2;
-   const Watcher & w = two.getWatcher(refs[mid].listPos, refs[mid].wPos);
-   s.getStatistic().medianLbd = std::min(w.getLbd(), db.getSharingHeuristic().maxVivificationLbd);
    int limit = std::min(getRemoveNumTwoWatchedClauses(), static_cast<unsigned>(refs.size()));
+   if (refs.size() > 0)
+   {
+      // move the median and then the removed clauses to the front
+      ReduceRef * begin = refs.data(), * end = refs.data() + refs.size();
+      const int mid = refs.size() / 2;
+      std::nth_element(begin, begin + mid, end, worseReduceRef);
+      const Watcher & w = two.getWatcher(refs[mid].listPos, refs[mid].wPos);
+      s.getStatistic().medianLbd = std::min(w.getLbd(), db.getSharingHeuristic().maxVivificationLbd);
+      if (limit < mid)
+         std::nth_element(begin, begin + limit, begin + mid, worseReduceRef);
+      else if (limit > mid + 1)
+         std::nth_element(begin + mid + 1, begin + limit, end, worseReduceRef);
+   }
 // mark as removed so they can be deleted without invalidating references
-   int i;
-   for (i = 0; i < limit; ++i)
+   for (int i = 0; i < limit; ++i)
    {
       assert(two.getWatcher(refs[i].listPos, refs[i].wPos).isHeader());
-      if (!db[two.getWatcher(refs[i].listPos, refs[i].wPos)].isPermanentClause())
-         two.getOtherWatcher(refs[i].listPos, refs[i].wPos).markAsRemoved();
-      else
-         break;
+      two.getOtherWatcher(refs[i].listPos, refs[i].wPos).markAsRemoved();
    }
    limit = refs.size() - limit;
    refs.clear(true);
@@ -573,7 +556,7 @@ void ClauseReducer::reduceOneWatched(const unsigned & keptTwo)
    };
    vec<OneRef> refs;
 // first collect references to clauses, and update clauses by reallocation, new versions or moves to two watched
-   for (int i = 0; i < one.size(); ++i)
+   for (int i = one.nextOccupied(0); i < one.size(); i = one.nextOccupied(i + 1))
    {
       vec<OneWatcher> &ws = one.getWatcher(i);
       for (int j = 0; j < ws.size(); ++j)
@@ -286,15 +286,18 @@ void SharedClause::initialize(const unsigned & numRefs)
    state() = tmp.state;
 }
 
+// The reference count is the lower half of the state, so it is changed by a single atomic add or
+// subtract on the whole state instead of a compare and swap loop, which has to be repeated for
+// every concurrent change of the other half. The count never drops below zero, so no borrow
+// reaches the replacement reference.
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "The reference count has to be the lower half of the state");
+
 void SharedClause::correctRealloc(const unsigned & numMaxRefs, const ReferenceStateChange & appliedChange)
 {
-   int32_t minusRefs = numMaxRefs - appliedChange.refs();
-   ReferenceStateChange expected(state()), desired;
-   do
-   {
-      assert(expected.refs() > minusRefs);
-      desired.set(expected.refs() - minusRefs, expected.cref());
-   } while (!state().compare_exchange_weak(expected.state, desired.state));
+   const int32_t minusRefs = numMaxRefs - appliedChange.refs();
+   const ReferenceStateChange previous(state().fetch_sub(minusRefs));
+   assert(previous.refs() > minusRefs);
+   (void) previous;
 }
 
 ReferenceStateChange SharedClause::markReallocated(const CRef & posForClause)
@@ -324,22 +327,14 @@ unsigned SharedClause::getNumRefs() const
 
 void SharedClause::referenceAdditional()
 {
-   ReferenceStateChange expected(state()), desired;
-   do
-   {
-      desired.set(expected.refs() + 1, expected.cref());
-   } while (!state().compare_exchange_weak(expected.state, desired.state));
+   state().fetch_add(1);
 }
 
 ReferenceStateChange SharedClause::dereference(CRef cref)
 {
-   ReferenceStateChange expected(state()), desired;
-   do
-   {
-      assert(expected.refs() > 0);
-      assert(expected.refs() < 500);
-      desired.set(expected.refs() - 1, expected.cref());
-   } while (!state().compare_exchange_weak(expected.state, desired.state));
+   ReferenceStateChange desired(state().fetch_sub(1) - 1);
+   assert(desired.refs() >= 0);
+   assert(desired.refs() < 500);
 
    //std::cout << "dereferenced to alloc: " << getAllocCount(desired) << " ref: " << getRefCount(desired) << std::endl;
    return desired;
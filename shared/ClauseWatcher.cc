@@ -76,14 +76,12 @@ copies or substantial portions of the Software;
 namespace Sticky
 {
 
-BinaryWatcher::BinaryWatcher(const CRef & cr, const Lit & p)
-      : blocker(p),
-        cref(cr)
+BinaryWatcher::BinaryWatcher(const Lit & p)
+      : blocker(p)
 {
 }
 BinaryWatcher::BinaryWatcher()
-      : blocker(lit_Undef),
-        cref(CRef_Undef)
+      : blocker(lit_Undef)
 {
 }
 
@@ -91,6 +89,7 @@ Watcher::Watcher(const CRef & cr, const Lit & p, const int & watchRef)
       : activity(0),
         _isProtected(false),
         _isImported(false),
+        _isUsed(false),
         lbd(MaxWatcherLBD),
         cref(cr),
         blocker(p),
@@ -102,6 +101,7 @@ Watcher::Watcher(const CRef & cr, const Lit & p, const int & watchRef, const uns
       : activity(activity),
         _isProtected(false),
         _isImported(false),
+        _isUsed(false),
         lbd(0),
         cref(cr),
         blocker(p),
@@ -114,6 +114,7 @@ Watcher::Watcher(const Watcher & w)
       : activity(w.activity),
         _isProtected(w._isProtected),
         _isImported(w._isImported),
+        _isUsed(w._isUsed),
         lbd(w.lbd),
         cref(w.cref),
         blocker(w.blocker),
@@ -125,6 +126,7 @@ Watcher::Watcher(Watcher && w)
       : activity(w.activity),
         _isProtected(w._isProtected),
         _isImported(w._isImported),
+        _isUsed(w._isUsed),
         lbd(w.lbd),
         cref(w.cref),
         blocker(w.blocker),
@@ -134,7 +136,8 @@ Watcher::Watcher(Watcher && w)
 
 TwoWatcherLists::TwoWatcherLists(ClauseBucketArray & cba, const unsigned & numLits)
       : cba(cba),
-        watcher(2 * numLits)
+        watcher(2 * numLits),
+        occupied(2 * numLits)
 {
 
 }
@@ -215,6 +218,7 @@ void TwoWatcherLists::moveWatcher(const int listPos, const int wPos, const Lit &
    vec<Watcher> & wsNew = getWatcher(~to);
    assert(cba.getClause(w.getCRef()).contains(to));
    assert(isValidWatcher(w));
+   markOccupied(getIndex(~to), wsNew);
    int newPos = wsNew.size();
    wsNew.push(w);
    wo.setOther(to, newPos);  // TODO cirtical prefetch?
@@ -465,6 +469,8 @@ VarSet TwoWatcherLists::plainAttach(CoreSolver & s, const CRef & cref, const Lit
    auto & ws2 = getWatcher(~l2);
    unsigned pos1 = ws1.size();
    unsigned pos2 = ws2.size();
+   markOccupied(getIndex(~l1), ws1);
+   markOccupied(getIndex(~l2), ws2);
    ws1.push(Watcher(cref, l2, pos2, lbd, activity));  // header watcher
    ws2.push(Watcher(cref, l1, pos1));  // non header, it is determined by the missing passed lbd
    assert(isValidWatcher(ws1.last()));
@@ -486,34 +492,37 @@ VarSet TwoWatcherLists::attachOneWatched(const OneWatcher & ow, CoreSolver & s,
    const BaseClause & c = cba.getClause(ow.getCRef());
    const LiteralSetting & litSet = s.getLiteralSetting();
    assert(c.contains(p));
-   int maxlevel = -1;
+   // watch the two literals of the highest levels, p is preferred on equal levels. After chronological
+   // backtracking p does not need to be of the highest level
+   auto preferred = [&](const int a, const int b)
+   {
+      return b == -1 || litSet.level(var(c[a])) > litSet.level(var(c[b])) || (litSet.level(var(c[a])) == litSet.level(var(c[b])) && c[a] == p);
+   };
    int index1 = -1, index2 = -1;
    for (int k = 0; k < c.size(); k++)
    {
       assert(litSet.value(c[k]) == l_False);
-      assert(litSet.level(var(c[k])) <= litSet.level(var(p)));
-      if (c[k] == p)
+      if (preferred(k, index1))
       {
+         index2 = index1;
          index1 = k;
-      } else if (litSet.level(var(c[k])) > maxlevel)
-      {
+      } else if (preferred(k, index2))
          index2 = k;
-         maxlevel = litSet.level(var(c[k]));
-      }
    }
-   assert(index1 != -1);
-   return plainAttach(s, ow.getCRef(), p, c[index2], lbd);
+   assert(index1 != -1 && index2 != -1);
+   return plainAttach(s, ow.getCRef(), c[index1], c[index2], lbd);
 }
 
 OneWatcherLists::OneWatcherLists(ClauseBucketArray & cba, const unsigned & numLits)
       : cba(cba),
-        watcher(2 * numLits)
+        watcher(2 * numLits),
+        occupied(2 * numLits)
 {
 }
 void TwoWatcherLists::removeMarkedClauses(CoreSolver & s)
 {
    int i, j, k;
-   for (i = 0; i < watcher.size(); ++i)
+   for (i = occupied.next(0); i < watcher.size(); i = occupied.next(i + 1))
    {
       ListType & ws = watcher[i];
       for (j = 0, k = 0; j < ws.size(); ++j)
@@ -544,7 +553,9 @@ void TwoWatcherLists::removeMarkedClauses(CoreSolver & s)
                PropagateResult pr;
                if (cu.c->size() == 2)
                {
-                  pr = s.getThreadState().binWatched.attach(cu.cref, s);
+                  // binaries are only kept in the watch lists, so drop the whole replace chain
+                  pr = s.getThreadState().binWatched.attach((*cu.c)[0], (*cu.c)[1], s);
+                  cba.removeClause(s, w.getCRef());
                } else
                   pr = this->attach(cu.cref, s, (c.isPermanentClause()) ? c.getLbd() : ((w.isHeader()) ? w.getLbd() : getOtherWatcher(w).getLbd()));
                --s.getStatistic().nTwoWatchedClauses;
@@ -567,6 +578,8 @@ void TwoWatcherLists::removeMarkedClauses(CoreSolver & s)
          }
       }
       ws.resize_(k);
+      if (k == 0)
+         occupied.unmark(i);
    }
    assertCorrectWatchers(s);
    assert(s.getThreadState().toVivifyRefs.size() == 0);
@@ -576,7 +589,7 @@ void TwoWatcherLists::removeMarkedClauses(CoreSolver & s, vec<CRef> & permRefs)
 {
    assert(s.getThreadState().toVivifyRefs.size() == 0);
    int i, j, k;
-   for (i = 0; i < watcher.size(); ++i)
+   for (i = occupied.next(0); i < watcher.size(); i = occupied.next(i + 1))
    {
       ListType & ws = watcher[i];
       for (j = 0, k = 0; j < ws.size(); ++j)
@@ -606,7 +619,8 @@ void TwoWatcherLists::removeMarkedClauses(CoreSolver & s, vec<CRef> & permRefs)
             {
                if (cu.c->size() == 2)
                {
-                  s.getThreadState().binWatched.attach(cu.cref, s);
+                  s.getThreadState().binWatched.attach((*cu.c)[0], (*cu.c)[1], s);
+                  cba.removeClause(s, w.getCRef());
                } else
                   this->attachOnFirst(cu.cref, s, (c.isPermanentClause()) ? c.getLbd() : ((w.isHeader()) ? w.getLbd() : getOtherWatcher(w).getLbd()));
                --s.getStatistic().nTwoWatchedClauses;
@@ -625,6 +639,8 @@ void TwoWatcherLists::removeMarkedClauses(CoreSolver & s, vec<CRef> & permRefs)
          }
       }
       ws.resize_(k);
+      if (k == 0)
+         occupied.unmark(i);
    }
    assertCorrectWatchers(s);
 }
@@ -632,7 +648,7 @@ vec<CRef> TwoWatcherLists::getAllCRefs() const
 {
    int i, j;
    vec<CRef> res;
-   for (i = 0; i < watcher.size(); ++i)
+   for (i = occupied.next(0); i < watcher.size(); i = occupied.next(i + 1))
    {
       const ListType & ws = watcher[i];
       for (j = 0; j < ws.size(); ++j)
@@ -648,7 +664,7 @@ vec<CRef> TwoWatcherLists::getAllCRefs() const
 void OneWatcherLists::removeMarkedClauses(CoreSolver & s)
 {
    int j, k;
-   for (int i = 0; i < size(); ++i)
+   for (int i = occupied.next(0); i < size(); i = occupied.next(i + 1))
    {
       ListType & curList = watcher[i];
       for (j = 0, k = 0; j < curList.size(); ++j)
@@ -679,6 +695,8 @@ void OneWatcherLists::removeMarkedClauses(CoreSolver & s)
       }
       s.getStatistic().nOneWatchedClauses -= j-k;
       curList.shrink(j-k);
+      if (k == 0)
+         occupied.unmark(i);
    }
 }
 VarSet OneWatcherLists::replace(CoreSolver & s, const int listPos, const int wPos, const CRef & cref)
@@ -713,7 +731,9 @@ bool OneWatcherLists::attach(const CRef & cref, const BaseClause & c, CoreSolver
    for (; i < c.size(); ++i)
       if (litSet.value(c[i]) != l_False)
       {
-         getWatcher(~c[i]).push(OneWatcher(cref, c[((i + 1 < c.size()) ? i + 1 : 0)]));
+         ListType & ws = getWatcher(~c[i]);
+         markOccupied(getIndex(~c[i]), ws);
+         ws.push(OneWatcher(cref, c[((i + 1 < c.size()) ? i + 1 : 0)]));
          ++s.getStatistic().nOneWatchedClauses;
          break;
       }
@@ -745,26 +765,31 @@ void OneWatcherLists::detach(CoreSolver& s, const VarSet & vs)
    watcher[vs.getListPos()].unordered_remove(vs.getWatcherPos());
 }
 
-BinaryWatcherLists::BinaryWatcherLists(ClauseBucketArray & cba, const unsigned & numLits)
-      : cba(cba),
-        watcher(2 * numLits)
+BinaryWatcherLists::BinaryWatcherLists(const unsigned & numLits)
+      : watcher(2 * numLits)
 {
 }
 
 bool BinaryWatcherLists::isConsistent() const
 {
    bool res = true;
-   std::unordered_map<CRef, unsigned> counter;
+   std::unordered_map<uint64_t, unsigned> counter;
    for (int i = 0; i < watcher.size(); ++i)
    {
       const vec<BinaryWatcher> & ws = watcher[i];
+      Lit cur;
+      cur.x = i;
       for (int j = 0; j < ws.size(); ++j)
-         ++counter[ws[j].getCRef()];
+      {
+         const Lit a = ~cur, b = ws[j].getBlocker();
+         const uint64_t key = (a < b) ? (static_cast<uint64_t>(toInt(a)) << 32) | toInt(b) : (static_cast<uint64_t>(toInt(b)) << 32) | toInt(a);
+         ++counter[key];
+      }
    }
 
    for (const auto & p : counter)
    {
-      if (p.second != 2)
+      if (p.second % 2 != 0)
       {
          res = false;
          break;
@@ -773,19 +798,17 @@ bool BinaryWatcherLists::isConsistent() const
    return res;
 }
 
-PropagateResult BinaryWatcherLists::attach(const CRef & cref, CoreSolver & s)
+PropagateResult BinaryWatcherLists::attach(const Lit & a, const Lit & b, CoreSolver & s)
 {
    ++s.getStatistic().nTwoWatchedClauses;
-   const BaseClause & c = cba.getClause(cref);
-   assert(c.size() == 2);
+   assert(var(a) != var(b));
+   const Lit c[2] = { a, b };
    const LiteralSetting & litSet = s.getLiteralSetting();
    PropagateResult res;
    auto & ws1 = getWatcher(~c[0]), &ws2 = getWatcher(~c[1]);
-   ws1.push(BinaryWatcher(cref, c[1]));
-   ws2.push(BinaryWatcher(cref, c[0]));
-   res.getVarSet().set(BinaryWatcher(), (~c[0]).x, ws1.size() - 1);
-   assert(c.contains(ws1.last().getBlocker()));
-   assert(c.contains(ws2.last().getBlocker()));
+   ws1.push(BinaryWatcher(c[1]));
+   ws2.push(BinaryWatcher(c[0]));
+   res.getVarSet().set(BinaryWatcher(), (~c[1]).x, ws2.size() - 1);  // implies c[0]
    if (litSet.value(c[0]) == l_False && litSet.value(c[1]) == l_False)  // conflict!
    {
       res.setConflict(true);
@@ -79,6 +79,8 @@ namespace Sticky
 class ClauseBucketArray;
 class CoreSolver;
 
+// Binary clauses are not stored in the clause buckets, the watcher itself holds the clause:
+// a watcher in the list of p represents the clause (~p v blocker).
 struct BinaryWatcher
 {
 
@@ -89,27 +91,17 @@ struct BinaryWatcher
 
    BinaryWatcher();
 
-   BinaryWatcher(const CRef & cr, const Lit & p);
+   BinaryWatcher(const Lit & p);
 
    inline const Lit & getBlocker() const
    {
       return blocker;
    }
 
-   inline const CRef & getCRef() const
-   {
-      return cref;
-   }
-
-   inline void setCRef(const CRef & cr)
-   {
-      cref = cr;
-   }
-
  private:
    Lit blocker;
-   CRef cref;
 };
+static_assert(sizeof(BinaryWatcher) == sizeof(Lit), "Binary watcher holds more than the implied literal");
 
 
 struct Watcher
@@ -155,10 +147,12 @@ struct Watcher
       cref = cr;
    }
 
+   // MaxWatcherLBD marks the non header watcher, larger lbds are stored as the value below it
    inline void setLbd(const unsigned & l)
    {
       assert(isHeader());
-      lbd = (l < MaxWatcherLBD) ? l : MaxWatcherLBD;
+      lbd = (l < MaxWatcherLBD) ? l : MaxWatcherLBD - 1;
+      assert(isHeader());
    }
 
    inline unsigned getLbd() const
@@ -180,6 +174,21 @@ struct Watcher
       return activity == ActivityStateDeleted;
    }
 
+   // The non header watcher stores the clause position where the last search for a new watched
+   // literal succeeded. Shared clauses cannot be reordered, so the next search resumes there.
+   inline unsigned getSearchPos() const
+   {
+      assert(!isHeader());
+      return (activity == ActivityStateDeleted) ? 0 : activity;
+   }
+
+   inline void setSearchPos(const unsigned & pos)
+   {
+      assert(!isHeader());
+      if (activity != ActivityStateDeleted)
+         activity = (pos < ActivityStateValid) ? pos : 0;
+   }
+
    inline void setProtected(const bool isProt)
    {
       assert(!isHeader());
@@ -192,11 +201,25 @@ struct Watcher
       return _isProtected;
    }
 
+   // also marks the clause as used since the last reduce
    inline void increaseActivity()
    {
       assert(isHeader());
       if (activity < ActivityStateValid)
          ++activity;
+      _isUsed = true;
+   }
+
+   inline bool isUsed() const
+   {
+      assert(isHeader());
+      return _isUsed;
+   }
+
+   inline void resetUsed()
+   {
+      assert(isHeader());
+      _isUsed = false;
    }
 
    inline void decreaseActivity()
@@ -255,6 +278,7 @@ struct Watcher
       assert(activity == in.activity);
       assert(_isProtected == in._isProtected);
       assert(_isImported == in._isImported);
+      assert(_isUsed == in._isUsed);
       assert(lbd == in.lbd);
       assert(blockerWatchRef == in.blockerWatchRef);
       return *this;
@@ -267,6 +291,7 @@ struct Watcher
       activity = in.activity;
       _isProtected = in._isProtected;
       _isImported = in._isImported;
+      _isUsed = in._isUsed;
       lbd = in.lbd;
       blockerWatchRef = in.blockerWatchRef;
       return *this;
@@ -275,15 +300,19 @@ struct Watcher
  private:
    static constexpr uint16_t ActivityStateDeleted = std::numeric_limits<uint16_t>::max();
    static constexpr uint16_t ActivityStateValid = std::numeric_limits<uint16_t>::max()-1;
-   static constexpr uint16_t MaxWatcherLBD = std::numeric_limits<uint16_t>::max()/2;
+   // the lbd shares its 16 bits with the three flags
+   static constexpr unsigned LbdBits = sizeof(uint16_t) * 8 - 3;
+   static constexpr uint16_t MaxWatcherLBD = (1u << LbdBits) - 1;
    uint16_t activity;
    uint16_t _isProtected : 1;
    uint16_t _isImported : 1;
-   uint16_t lbd : sizeof(uint16_t)*8-2;
+   uint16_t _isUsed : 1;
+   uint16_t lbd : LbdBits;
    CRef cref;
    Lit blocker;
    unsigned blockerWatchRef;
 
+   static_assert(MaxWatcherLBD == std::numeric_limits<uint16_t>::max() >> (16 - LbdBits), "The non header sentinel has to fit into the lbd field");
 };
 
 struct OneWatcher
@@ -336,6 +365,50 @@ struct OneWatcher
 };
 
 
+// Bitmap of the watch lists that may be non empty. A push onto an empty list sets its bit and the
+// sweeps over all clauses of a thread clear the bits of the lists they find empty. The sweeps skip
+// the lists without bit, so on instances with many variables and few clauses they are linear in
+// the number of watchers instead of the number of literals.
+class ListOccupancy
+{
+ public:
+   explicit ListOccupancy(const int numLists)
+         : numLists(numLists),
+           bits((numLists + 63) / 64, 0)
+   {
+   }
+
+   inline void mark(const int list)
+   {
+      bits[list >> 6] |= uint64_t(1) << (list & 63);
+   }
+
+   inline void unmark(const int list)
+   {
+      bits[list >> 6] &= ~(uint64_t(1) << (list & 63));
+   }
+
+   // first marked list at or after from, numLists if there is none
+   inline int next(const int from) const
+   {
+      if (from >= numLists)
+         return numLists;
+      int word = from >> 6;
+      uint64_t cur = bits[word] & (~uint64_t(0) << (from & 63));
+      while (cur == 0)
+      {
+         if (++word == bits.size())
+            return numLists;
+         cur = bits[word];
+      }
+      return (word << 6) + __builtin_ctzll(cur);
+   }
+
+ private:
+   int numLists;
+   vec<uint64_t> bits;
+};
+
 class TwoWatcherLists
 {
  public:
@@ -365,6 +438,18 @@ class TwoWatcherLists
       return (l).x;
    }
 
+   // has to be called before a watcher is pushed onto a list by other code than this class
+   inline void markOccupied(const int listPos, const ListType & ws)
+   {
+      if (ws.size() == 0)
+         occupied.mark(listPos);
+   }
+   // first list at or after from that may hold watchers, size() if there is none
+   inline int nextOccupied(const int from) const
+   {
+      return occupied.next(from);
+   }
+
    VarSet getVarSet(const WType & w) const;
    WType & getWatcher(const VarSet & vs);
    WType & getStateWatcher(const VarSet & vs);
@@ -397,6 +482,7 @@ class TwoWatcherLists
  private:
    ClauseBucketArray & cba;
    vec<ListType> watcher;
+   ListOccupancy occupied;
 
    bool isMarkedAsRemoved(const Watcher & w) const;
 
@@ -494,12 +580,26 @@ class OneWatcherLists
    {
       return (l).x;
    }
+
+   // has to be called before a watcher is pushed onto a list by other code than this class
+   inline void markOccupied(const int listPos, const ListType & ws)
+   {
+      if (ws.size() == 0)
+         occupied.mark(listPos);
+   }
+   // first list at or after from that may hold watchers, size() if there is none
+   inline int nextOccupied(const int from) const
+   {
+      return occupied.next(from);
+   }
+
    bool isValidWatcher(const OneWatcher & w) const;
    void assertCorrectWatchers() const;
 
  private:
    ClauseBucketArray & cba;
    vec<ListType> watcher;
+   ListOccupancy occupied;
 
 };
 
@@ -570,7 +670,7 @@ class BinaryWatcherLists
    typedef BinaryWatcher WType;
    typedef vec<WType> ListType;
 
-   BinaryWatcherLists(ClauseBucketArray & cba, const unsigned & numLits);
+   BinaryWatcherLists(const unsigned & numLits);
    int size() const;
    // Needed for WatcherListReference:
    ListType & getWatcher(const Lit & p);
@@ -581,17 +681,18 @@ class BinaryWatcherLists
 
    const WType & getWatcher(const VarSet & vs) const;
    WType & getWatcher(const VarSet & vs);
-   const CRef & getCRef(const VarSet & vs) const;
+   // the clause of a binary reason or conflict, the first literal is the blocker:
+   Lit getFirstLit(const VarSet & vs) const;
+   Lit getSecondLit(const VarSet & vs) const;
 
    inline int getIndex(const Lit & l) const
    {
       return (l).x;
    }
 
-   PropagateResult attach(const CRef & cref, CoreSolver & s);
+   PropagateResult attach(const Lit & a, const Lit & b, CoreSolver & s);
 
  private:
-   ClauseBucketArray & cba;
    vec<ListType> watcher;
 
    bool isConsistent() const;
@@ -634,9 +735,13 @@ inline BinaryWatcherLists::WType & BinaryWatcherLists::getWatcher(const VarSet &
    assert(watcher[vs.getListPos()].size() > vs.getWatcherPos());
    return watcher[vs.getListPos()][vs.getWatcherPos()];
 }
-inline const CRef & BinaryWatcherLists::getCRef(const VarSet & vs) const
+inline Lit BinaryWatcherLists::getFirstLit(const VarSet & vs) const
 {
-   return getWatcher(vs).getCRef();
+   return getWatcher(vs).getBlocker();
+}
+inline Lit BinaryWatcherLists::getSecondLit(const VarSet & vs) const
+{
+   return vs.getWatchedLit();
 }
 
 } /* namespace Glucose */
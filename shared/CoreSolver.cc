@@ -71,12 +71,15 @@ copies or substantial portions of the Software;
 #include "shared/PropagateResult.h"
 #include "shared/SharedTypes.h"
 #include "shared/Heuristic.h"
+#include "shared/LiteralSearch.h"
+#include "shared/LocalSearch.h"
 #include "shared/Statistic.h"
 #include "glucose/simp/SimpSolver.h"
 
 #include <math.h>
 #include <limits>
 #include <algorithm>
+#include <cstring>
 
 using namespace Sticky;
 
@@ -103,16 +106,33 @@ CoreSolver::CoreSolver(ClauseDatabase & scDb, const SimpSolver & s, const unsign
         lbdRoundCounter(0),
         reduceOnSize(false),
         lubyConflictlimit(luby(2, 0)*100),
+        nextRephase(std::numeric_limits<uint64_t>::max()),
+        stable(false),
+        modeBudget(0),
+        nextModeSwitch(0),
+        walkPropagations(0),
+        setting(0),
+        requestedSetting(0),
         reduceOnSizeSize(12),  // Constant to use on size reductions
-        permDiff(s.nVars(), 0),
+        permDiff(s.nVars() + 1, 0),
         lastDecisionLevel(),
         seen(s.nVars(), 0),
+        levelCount(s.nVars() + 1, 0),
+        keptLits(),
+        luckyOccurrences(),
+        otfsClauses(),
+        otfsLits(),
+        walkPhases(),
         analyze_stack(),
+        analyze_block(),
         analyze_toclear(),
-        trailQueue(),
-        lbdQueue(),
         heuristic(),
         statistic(),
+        binImplications(2 * s.nVars(), heuristic.maxBinaryImplications),
+        trailAverage(heuristic.sizeTrailQueue),
+        fastLbd(heuristic.sizeLBDQueue),
+        slowLbd(heuristic.sizeSlowLBDQueue),
+        restartConflicts(0),
         cDb(scDb),
         lState(s, ((double) threadId + 1.0) * heuristic.random_seed),
         dbState(threadId, s.nVars(), cDb.getBuckets()),
@@ -135,28 +155,32 @@ CoreSolver::CoreSolver(ClauseDatabase & scDb, const SimpSolver & s, const unsign
    // check:
    for (int i = 0; i < s.vardata.size(); ++i)
       assert(s.vardata[i].level == 0);  // we cannot allow references to other clauses than the ones in the db
-   lbdQueue.initSize(heuristic.sizeLBDQueue);
-   trailQueue.initSize(heuristic.sizeTrailQueue);
    s.model.memCopyTo(model);
    s.conflict.memCopyTo(conflict);
    //s.decision.memCopyTo(decision);
-   s.lbdQueue.copyTo(lbdQueue);
-   s.trailQueue.copyTo(trailQueue);
 
    dbState.nConflictsBeforeReduce = heuristic.firstReduceDb;
+   if (!LiteralSearch::isApplicable(s.nVars()))
+      heuristic.simdSearchSize = std::numeric_limits<int>::max();
 
-   const auto & buckets = scDb.getBuckets();
+   auto & buckets = scDb.getBuckets();
+   if (heuristic.lucky)
+      luckyOccurrences.growTo(s.nVars(), 0);
    for (int i = 0; i < initCRefs.size(); ++i)
    {
       const CRef & cr = initCRefs[i];
       const BaseClause & c = buckets.getClause(cr);
+      if (heuristic.lucky)
+         for (int j = 0; j < c.size(); ++j)
+            luckyOccurrences[var(c[j])] += sign(c[j]) ? -1 : 1;
       bool abort;
       if (c.size() > 2)
          abort = dbState.twoWatched.attach(cr, *this, 0).isConflict();
       else
       {
          assert(c.size() == 2);
-         abort = dbState.binWatched.attach(cr, *this).isConflict();
+         abort = dbState.binWatched.attach(c[0], c[1], *this).isConflict();
+         buckets.removeClause(*this, cr);  // binaries are kept in the watch lists only
       }
       if (abort)
       {
@@ -175,49 +199,13 @@ CoreSolver::~CoreSolver()
  * Compute LBD functions
  *************************************************************/
 
-unsigned int CoreSolver::computeLBD(const vec<Lit> & lits)
+unsigned int CoreSolver::sizeAdjustedLBD(const int nblevels, const int size) const
 {
-   int nblevels = 0;
-   lbdRoundCounter++;
-
-   for (int i = 0; i < lits.size(); i++)
-   {
-      int l = lState.level(var(lits[i]));
-      if (permDiff[l] != lbdRoundCounter)
-      {
-         permDiff[l] = lbdRoundCounter;
-         nblevels++;
-      }
-   }
-
-   if (!reduceOnSize)
-      return nblevels;
-   if (lits.size() < reduceOnSizeSize)
-      return lits.size();  // See the XMinisat paper
-   return lits.size() + nblevels;
-}
-
-unsigned int CoreSolver::computeLBD(const BaseClause &c)
-{
-   int nblevels = 0;
-   lbdRoundCounter++;
-
-   for (int i = 0; i < c.size(); i++)
-   {
-      int l = lState.level(var(c[i]));
-      if (permDiff[l] != lbdRoundCounter)
-      {
-         permDiff[l] = lbdRoundCounter;
-         nblevels++;
-      }
-   }
-
    if (!reduceOnSize)
       return nblevels;
-   if (c.size() < reduceOnSizeSize)
-      return c.size();  // See the XMinisat paper
-   return c.size() + nblevels;
-
+   if (size < reduceOnSizeSize)
+      return size;  // See the XMinisat paper
+   return size + nblevels;
 }
 
 void CoreSolver::setResult(const lbool res, const std::string & msg)
@@ -231,12 +219,12 @@ void CoreSolver::setResult(const lbool res, const std::string & msg)
  ******************************************************************/
 void CoreSolver::minimisationWithBinaryResolution(vec<Lit> &out_learnt)
 {
-
-// Find the LBD measure
-   unsigned int lbd = computeLBD(out_learnt);
    Lit p = ~out_learnt[0];
 
-   if (lbd <= heuristic.lbLBDMinimizingClause)
+   // the literals implied by p through chains of binary clauses are cached, so the clause is not
+   // restricted to a small LBD anymore
+   const vec<Lit> & implied = binImplications.getImplications(dbState.binWatched, p);
+   if (implied.size() > 0)
    {
       lbdRoundCounter++;
 
@@ -244,11 +232,10 @@ void CoreSolver::minimisationWithBinaryResolution(vec<Lit> &out_learnt)
       {
          permDiff[var(out_learnt[i])] = lbdRoundCounter;
       }
-      const vec<BinaryWatcher> & wbin = dbState.binWatched.getWatcher(p);
       int nb = 0;
-      for (int i = 0; i < wbin.size(); ++i)
+      for (int i = 0; i < implied.size(); ++i)
       {
-         Lit imp = wbin[i].getBlocker();
+         Lit imp = implied[i];
          if (permDiff[var(imp)] == lbdRoundCounter && lState.value(imp) == l_True)
          {
             nb++;
@@ -274,24 +261,36 @@ void CoreSolver::minimisationWithBinaryResolution(vec<Lit> &out_learnt)
 }
 
 // Revert to the state at given level (keeping all assignment at 'level' but not beyond).
+// After chronological backtracking the trail can contain literals of lower levels above the level
+// separator, those are kept and propagated again.
 //
 void CoreSolver::cancelUntil(const int level)
 {
    if (lState.decisionLevel() > level)
    {
+      keptLits.clear();
       for (int c = lState.trail.size() - 1; c >= lState.trail_lim[level]; c--)
       {
          Var x = var(lState.trail[c]);
+         if (lState.level(x) <= level)
+         {
+            keptLits.push(lState.trail[c]);
+            continue;
+         }
          lState.state[x].assign = l_Undef;
          if (heuristic.phase_saving > 1 || ((heuristic.phase_saving == 1) && c > lState.trail_lim.last()))
          {
             lState.state[x].polarity = sign(lState.trail[c]);
          }
+         if (lState.branching == Branching::LRB)
+            lState.lrbUnassigned(x, statistic.nConflicts);
          lState.insertVarOrder(x);
       }
       lState.qhead = lState.trail_lim[level];
       lState.trail.shrink(lState.trail.size() - lState.trail_lim[level]);
       lState.trail_lim.shrink(lState.trail_lim.size() - level);
+      for (int i = keptLits.size() - 1; i >= 0; --i)
+         lState.trail.push_(keptLits[i]);
       //std::cout << "backtrack level " << level << "\n";
    }
 }
@@ -313,27 +312,31 @@ inline Lit CoreSolver::pickBranchLit()
    }
 
 // Activity based decision:
-   while (next == var_Undef || lState.value(next) != l_Undef)
-      if (lState.order_heap.empty())
-      {
-         next = var_Undef;
-         break;
-      } else
-      {
-         next = lState.order_heap.removeMin();
-      }
-   return next == var_Undef ? lit_Undef : mkLit(next, heuristic.rnd_pol ? drand(heuristic.random_seed) < 0.5 : lState.state[next].polarity);
+   if (next == var_Undef || lState.value(next) != l_Undef)
+      next = lState.nextDecisionVar();
+   return next == var_Undef ? lit_Undef : mkLit(next, heuristic.rnd_pol ? drand(heuristic.random_seed) < 0.5 : lState.decisionPolarity(next, heuristic.targetPhases || stable));
 }
 
-const BaseClause & CoreSolver::getClause(const VarSet & vs) const
+// Marks a level in the current LBD round, returns 1 if it was not marked before.
+inline int CoreSolver::stampLevel(const int level)
 {
-   return cDb(*this, vs);
+   const int res = permDiff[level] != lbdRoundCounter;
+   permDiff[level] = lbdRoundCounter;
+   return res;
 }
 
-const BaseClause & CoreSolver::getClause(const Var v) const
+inline ClauseView CoreSolver::getClause(const VarSet & vs) const
+{
+   if (vs.getWatcherType() == WatcherType::BINARY)
+      return ClauseView(dbState.binWatched.getFirstLit(vs), dbState.binWatched.getSecondLit(vs));
+   else
+      return ClauseView(cDb(*this, vs));
+}
+
+inline ClauseView CoreSolver::getClause(const Var v) const
 {
    assert(lState.reason(v).isPropagated());
-   return cDb(*this, lState.reason(v));
+   return getClause(lState.reason(v));
 }
 
 /*_________________________________________________________________________________________________
@@ -363,7 +366,7 @@ void CoreSolver::findDecisionClauseForPropagation(Lit p, vec<Lit>& out_conflict)
             out_conflict.push(~lState.trail[i]);
          } else
          {
-            const BaseClause& c = getClause(lState.reason(x));
+            const ClauseView c = getClause(lState.reason(x));
             for (int j = 0; j < c.size(); j++)
                if (var(p) != var(c[j]) && lState.level(var(c[j])) > 0)
                   seen[var(c[j])] = 1;
@@ -379,7 +382,7 @@ void CoreSolver::findDecisionClauseForPropagation(Lit p, vec<Lit>& out_conflict)
 bool CoreSolver::findDecisionClauseForConflict(const VarSet & confl, vec<Lit>& out_conflict, const CRef excludeRef)
 {
    bool res = true;
-   const BaseClause & conflC = getClause(confl);
+   const ClauseView conflC = getClause(confl);
    for (int i = 0; i < conflC.size(); ++i)
       seen[var(conflC[i])] = 1;
 
@@ -394,9 +397,9 @@ bool CoreSolver::findDecisionClauseForConflict(const VarSet & confl, vec<Lit>& o
             out_conflict.push(~lState.trail[i]);
          } else
          {
-            if (cDb.getCRef(*this, lState.reason(x)) == excludeRef)
+            if (excludeRef != CRef_Undef && cDb.getCRef(*this, lState.reason(x)) == excludeRef)
                res = false;  // no loop break here, seen must be reset
-            const BaseClause& c = getClause(lState.reason(x));
+            const ClauseView c = getClause(lState.reason(x));
             for (int j = 0; j < c.size(); j++)
             {
                assert(lState.value(c[j]) != l_Undef);
@@ -442,12 +445,15 @@ void CoreSolver::analyze(const VarSet & conflictProp, vec<Lit>& out_learnt, int&
    do
    {
       assert(prop.getWatcherType() != WatcherType::UNIT);  // (otherwise should be UIP)
-      cDb.notifyClauseUsedInConflict(*this, prop);
-      const BaseClause & c = getClause(prop);
+      const ClauseView c = getClause(prop);
+      int nZeroLevel = 0;
+      int nblevels = 0;  // the glue of the clause is counted in the same pass
+      lbdRoundCounter++;
       for (int j = 0; j < c.size(); ++j)
       {
          const Lit & q = c[j];
          assert(lState.value(q) != l_Undef);
+         nblevels += stampLevel(lState.level(var(q)));
          if (q != p)
          {
             const Var varQ = var(q);
@@ -455,10 +461,11 @@ void CoreSolver::analyze(const VarSet & conflictProp, vec<Lit>& out_learnt, int&
             {
                if (lState.level(varQ) == 0)
                {
+                  ++nZeroLevel;
                } else
                {  // Here, the old case
                   lState.varBumpActivity(varQ, heuristic);
-                  seen[varQ] = 1;
+                  seen[varQ] = SeenSource;
                   if (lState.level(varQ) >= lState.decisionLevel())
                   {
                      pathC++;
@@ -471,11 +478,18 @@ void CoreSolver::analyze(const VarSet & conflictProp, vec<Lit>& out_learnt, int&
             }
          }
       }
+      cDb.notifyClauseUsedInConflict(*this, prop, sizeAdjustedLBD(nblevels, c.size()));
+      // on the fly subsumption: the resolvent contains all literals of the reason except p
+      if (heuristic.otfs && p != lit_Undef && !c.isBinary() && out_learnt.size() - 1 + pathC == c.size() - 1 - nZeroLevel)
+         addOtfsClause(prop, c, p);
 
-// Select next clause to look at:
-      while (!seen[var(lState.trail[index--])])
-         assert(index >= -1);
-      p = lState.trail[index + 1];
+// Select next clause to look at, seen literals of lower levels are already part of the learnt clause:
+      do
+      {
+         while (!seen[var(lState.trail[index--])])
+            assert(index >= -1);
+         p = lState.trail[index + 1];
+      } while (lState.level(var(p)) < lState.decisionLevel());
       seen[var(p)] = 0;
       prop = lState.reason(var(p));
       pathC--;
@@ -487,7 +501,6 @@ void CoreSolver::analyze(const VarSet & conflictProp, vec<Lit>& out_learnt, int&
       assert(lState.level(out_learnt[i]) <= lState.level(p));
       assert(out_learnt[i] != ~p);
    }
-
 // Simplify conflict clause:
 //
    int i, j;
@@ -495,14 +508,15 @@ void CoreSolver::analyze(const VarSet & conflictProp, vec<Lit>& out_learnt, int&
 
    if (heuristic.ccmin_mode == 2)
    {
-      uint32_t abstract_level = 0;
       for (i = 1; i < out_learnt.size(); i++)
-         abstract_level |= lState.abstractLevel(var(out_learnt[i]));  // (maintain an abstraction of levels involved in conflict)
+         ++levelCount[lState.level(var(out_learnt[i]))];  // (count the literals of each level involved in conflict)
 
       for (i = j = 1; i < out_learnt.size(); i++)
-         if (!lState.reason(var(out_learnt[i])).isPropagated() || !litRedundant(out_learnt[i], abstract_level))
+         if (!lState.reason(var(out_learnt[i])).isPropagated() || !litRedundant(out_learnt[i]))
             out_learnt[j++] = out_learnt[i];
 
+      for (int k = 1; k < i; k++)
+         levelCount[lState.level(var(analyze_toclear[k]))] = 0;
    } else if (heuristic.ccmin_mode == 1)
    {
       for (i = j = 1; i < out_learnt.size(); i++)
@@ -513,7 +527,7 @@ void CoreSolver::analyze(const VarSet & conflictProp, vec<Lit>& out_learnt, int&
             out_learnt[j++] = out_learnt[i];
          else
          {
-            const BaseClause& c = cDb(*this, lState.reason(var(out_learnt[i])));
+            const ClauseView c = getClause(x);
             for (int k = ((c.size() == 2) ? 0 : 1); k < c.size(); k++)
                if (!seen[var(c[k])] && lState.level(var(c[k])) > 0)
                {
@@ -527,6 +541,9 @@ void CoreSolver::analyze(const VarSet & conflictProp, vec<Lit>& out_learnt, int&
 
    out_learnt.shrink(i - j);
 
+   if (heuristic.shrink)
+      shrinkLearnt(out_learnt);
+
    /* ***************************************
     Minimisation with binary clauses of the asserting clause
     First of all : we look for small clauses
@@ -535,73 +552,273 @@ void CoreSolver::analyze(const VarSet & conflictProp, vec<Lit>& out_learnt, int&
     */
    if (out_learnt.size() <= heuristic.lbSizeMinimizingClause)
       minimisationWithBinaryResolution(out_learnt);
-// Find correct backtrack level:
+// Find correct backtrack level and compute the LBD in the same pass:
 //
+   lbdRoundCounter++;
+   int nblevels = stampLevel(lState.level(var(out_learnt[0])));
    if (out_learnt.size() == 1)
       out_btlevel = 0;
    else
    {
       int max_i = 1;
+      nblevels += stampLevel(lState.level(var(out_learnt[1])));
 // Find the first literal assigned at the next-highest level:
       for (int i = 2; i < out_learnt.size(); i++)
-         if (lState.level(var(out_learnt[i])) > lState.level(var(out_learnt[max_i])))
+      {
+         const int level = lState.level(var(out_learnt[i]));
+         nblevels += stampLevel(level);
+         if (level > lState.level(var(out_learnt[max_i])))
             max_i = i;
+      }
 // Swap-in this literal at index 1:
       Lit p = out_learnt[max_i];
       out_learnt[max_i] = out_learnt[1];
       out_learnt[1] = p;
       out_btlevel = lState.level(var(p));
    }
+   lbd = sizeAdjustedLBD(nblevels, out_learnt.size());
 
-// Compute LBD
-   lbd = computeLBD(out_learnt);
-
-// UPDATEVARACTIVITY trick (see competition'09 companion paper)
+// UPDATEVARACTIVITY trick (see competition'09 companion paper), the learning rate branching
+// counts the participation of each variable once per conflict
    if (lastDecisionLevel.size() > 0)
    {
-      for (int i = 0; i < lastDecisionLevel.size(); i++)
-      {
-         if (cDb.getLbd(*this, lState.reason(var(lastDecisionLevel[i]))) < lbd)
-            lState.varBumpActivity(var(lastDecisionLevel[i]), heuristic);
-      }
+      if (lState.branching != Branching::LRB)
+         for (int i = 0; i < lastDecisionLevel.size(); i++)
+         {
+            if (cDb.getLbd(*this, lState.reason(var(lastDecisionLevel[i]))) < lbd)
+               lState.varBumpActivity(var(lastDecisionLevel[i]), heuristic);
+         }
       lastDecisionLevel.clear();
    }
+   // reason side rate of the learning rate branching: variables in the reasons of the learnt
+   // clause, each counted once by marking it as seen
+   if (lState.branching == Branching::LRB)
+      for (int i = 0; i < out_learnt.size(); ++i)
+      {
+         const Var v = var(out_learnt[i]);
+         if (lState.reason(v).isPropagated())
+         {
+            const ClauseView c = getClause(v);
+            for (int k = 0; k < c.size(); ++k)
+            {
+               const Var x = var(c[k]);
+               if (x != v && !seen[x] && lState.level(x) > 0)
+               {
+                  seen[x] = SeenSource;
+                  analyze_toclear.push(c[k]);
+                  lState.lrbReasoned(x);
+               }
+            }
+         }
+      }
    for (int j = 0; j < analyze_toclear.size(); j++)
       seen[var(analyze_toclear[j])] = 0;  // ('seen[]' is now cleared)
 }
 
-// Check if 'p' can be removed. 'abstract_levels' is used to abort early if the algorithm is
-// visiting literals at levels that cannot be removed later.
+// Remembers the reason 'c' of 'p' without p. The clause is not changed during the analysis, since
+// it is still the reason of p and other literals are watched in it.
+//
+void CoreSolver::addOtfsClause(const VarSet & reason, const ClauseView & c, const Lit p)
+{
+   if (otfsClauses.size() >= OtfsMaxClauses)
+      return;
+   const int begin = otfsLits.size();
+   for (int i = 0; i < c.size(); ++i)
+      if (c[i] != p)
+         otfsLits.push(c[i]);
+   otfsClauses.push( { cDb.getCRef(*this, reason), begin, otfsLits.size() });
+}
 
-bool CoreSolver::litRedundant(Lit p, uint32_t abstract_levels)
+// Replaces the remembered reasons by their strengthened version. It runs on level 0 before the
+// database is reduced, where the clauses can be exchanged like in the vivification. Clauses that
+// were replaced in the meantime are skipped.
+//
+void CoreSolver::strengthenOtfsClauses()
 {
-   analyze_stack.clear();
-   analyze_stack.push(p);
-   int top = analyze_toclear.size();
-   while (analyze_stack.size() > 0)
+   assert(lState.decisionLevel() == 0);
+   vec<Lit> newC;
+   for (int i = 0; i < otfsClauses.size() && result == l_Undef; ++i)
    {
-      assert(lState.reason(var(analyze_stack.last())).isPropagated());
-      const BaseClause& c = getClause(lState.reason(var(analyze_stack.last())));
-      analyze_stack.pop();  //
+      const OtfsClause & oc = otfsClauses[i];
+      const ClauseBucketArray & buckets = cDb.getBuckets();
+      const BaseClause & c = buckets.getClause(oc.cref);
+      if (c.size() != oc.end - oc.begin + 1)
+         continue;
+      newC.clear();
+      bool valid = true;
+      for (int j = oc.begin; j < oc.end && valid; ++j)
+      {
+         const Lit l = otfsLits[j];
+         valid = c.contains(l) && lState.value(l) != l_True;
+         if (lState.value(l) == l_Undef)
+            newC.push(l);
+      }
+      if (!valid || newC.size() == 0)
+         continue;
+      const VarSet pos = dbState.twoWatched.findWatcher(oc.cref);
+      // like in the vivification, clauses with a pending replacement or removal are skipped
+      if (!pos.isValid() || buckets.shouldBeRemoved(oc.cref) || buckets.shouldBeReplaced(oc.cref) || c.isReplaced() || c.isPrivDel())
+         continue;
+      const unsigned lbd = cDb.getLbd(*this, pos);
+      if (cDb.replaceClause(*this, oc.cref, newC, (lbd < static_cast<unsigned>(newC.size())) ? lbd : newC.size()) && newC.size() == 1)
+         uncheckedEnqueue(newC[0], VarSet());
+   }
+   otfsClauses.clear();
+   otfsLits.clear();
+}
 
-      for (int i = 0; i < c.size(); i++)
+// Sorts the literals after the asserting literal by decreasing level and replaces each level block
+// of at least two literals by the negation of its block level UIP, if one exists.
+//
+void CoreSolver::shrinkLearnt(vec<Lit> & out_learnt)
+{
+   if (out_learnt.size() < 3)
+      return;
+   const LiteralSetting & ls = lState;
+   sort(&out_learnt[1], out_learnt.size() - 1, [&ls](const Lit & a, const Lit & b)
+   {
+      return ls.level(var(a)) > ls.level(var(b));
+   });
+
+   int i = 1, j = 1;
+   while (i < out_learnt.size())
+   {
+      const int level = lState.level(var(out_learnt[i]));
+      int end = i + 1;
+      while (end < out_learnt.size() && lState.level(var(out_learnt[end])) == level)
+         ++end;
+      const Lit uip = (end - i > 1) ? findBlockUIP(out_learnt, i, end) : lit_Undef;
+      if (uip != lit_Undef)
+         out_learnt[j++] = ~uip;
+      else
+         for (int k = i; k < end; ++k)
+            out_learnt[j++] = out_learnt[k];
+      i = end;
+   }
+   out_learnt.shrink(i - j);
+}
+
+// Walks the trail of the level of out_learnt[begin, end) backwards and resolves the literals of
+// this level until one is left. Fails when a reason contains an unseen literal of a lower level.
+//
+Lit CoreSolver::findBlockUIP(const vec<Lit> & out_learnt, const int begin, const int end)
+{
+   const int level = lState.level(var(out_learnt[begin]));
+   assert(level > 0 && level < lState.decisionLevel());
+   analyze_block.clear();
+   for (int i = begin; i < end; ++i)
+   {
+      seen[var(out_learnt[i])] = SeenBlock;
+      analyze_block.push(out_learnt[i]);
+   }
+   int open = end - begin;
+   Lit uip = lit_Undef;
+   for (int index = lState.trail_lim[level] - 1; index >= lState.trail_lim[level - 1]; --index)
+   {
+      const Var v = var(lState.trail[index]);
+      if (seen[v] != SeenBlock)
+         continue;
+      if (--open == 0)
       {
-         const Lit & q = c[i];
-         if (q != p && !seen[var(q)] && lState.level(var(q)) > 0)
+         uip = lState.trail[index];
+         break;
+      }
+      if (!lState.reason(v).isPropagated())
+         break;
+      const ClauseView c = getClause(v);
+      bool valid = true;
+      for (int k = 0; k < c.size() && valid; ++k)
+      {
+         const Var q = var(c[k]);
+         const int qLevel = lState.level(q);
+         if (q == v || qLevel == 0)
+            continue;
+         if (qLevel == level)
          {
-            if (lState.reason(var(q)).isPropagated() && (lState.abstractLevel(var(q)) & abstract_levels) != 0)
+            if (seen[q] != SeenBlock)
             {
-               seen[var(q)] = 1;
-               analyze_stack.push(q);
-               analyze_toclear.push(q);
-            } else
+               if (seen[q] == SeenUndef)
+                  analyze_toclear.push(c[k]);
+               seen[q] = SeenBlock;
+               analyze_block.push(c[k]);
+               ++open;
+            }
+         } else
+            valid = qLevel < level && (seen[q] == SeenSource || seen[q] == SeenRemovable);
+      }
+      if (!valid)
+         break;
+   }
+   // literals of an out of order level are not found on the level's trail part, then open stays
+   // positive and the block is kept
+   for (int i = 0; i < analyze_block.size(); ++i)
+      seen[var(analyze_block[i])] = SeenSource;
+   return uip;
+}
+
+// Check if 'p' can be removed. The search is a depth first walk over the reasons, literals that are
+// found to be removable or not are cached in 'seen' for the rest of the conflict. Literals of levels
+// without a literal in the learnt clause cannot be removed.
+
+bool CoreSolver::litRedundant(Lit p)
+{
+   // the implication graph of the level of p reaches its decision, if no other literal cuts it
+   if (levelCount[lState.level(var(p))] < 2)
+      return false;
+   analyze_stack.clear();
+   ClauseView c = getClause(var(p));
+   for (int i = 0;; i++)
+   {
+      if (i < c.size())
+      {
+         const Lit & q = c[i];
+         const Var varQ = var(q);
+         if (varQ == var(p) || lState.level(varQ) == 0 || seen[varQ] == SeenSource)
+            continue;
+         if (seen[varQ] == SeenRemovable)
+         {
+            ++statistic.nMinimizeCacheHits;
+            statistic.nMinimizeSavedLits += getClause(varQ).size() - 1;
+            continue;
+         }
+
+         if (seen[varQ] == SeenFailed || !lState.reason(varQ).isPropagated() || levelCount[lState.level(varQ)] == 0
+               || analyze_stack.size() >= heuristic.minimizeDepth)
+         {
+            if (seen[varQ] == SeenFailed)
             {
-               for (int j = top; j < analyze_toclear.size(); j++)
-                  seen[var(analyze_toclear[j])] = 0;
-               analyze_toclear.shrink(analyze_toclear.size() - top);
-               return false;
+               ++statistic.nMinimizeCacheHits;
+               statistic.nMinimizeSavedLits += getClause(varQ).size() - 1;
             }
+            analyze_stack.push( { 0, p });
+            for (int j = 0; j < analyze_stack.size(); j++)
+               if (seen[var(analyze_stack[j].l)] == SeenUndef)
+               {
+                  seen[var(analyze_stack[j].l)] = SeenFailed;
+                  analyze_toclear.push(analyze_stack[j].l);
+               }
+            return false;
+         }
+
+         // continue with the reason of q
+         analyze_stack.push( { i, p });
+         i = -1;
+         p = q;
+         c = getClause(varQ);
+      } else
+      {
+         // all literals of the reason of p are removable
+         if (seen[var(p)] == SeenUndef)
+         {
+            seen[var(p)] = SeenRemovable;
+            analyze_toclear.push(p);
          }
+         if (analyze_stack.size() == 0)
+            break;
+         i = analyze_stack.last().i;
+         p = analyze_stack.last().l;
+         c = getClause(var(p));
+         analyze_stack.pop();
       }
    }
 
@@ -618,10 +835,6 @@ PropagateResult CoreSolver::propagateBinary(const Lit p)
    for (int i = 0; i < wbin.size(); ++i)
    {
       const BinaryWatcher & w = wbin[i];
-      const BaseClause & c = cDb[w];
-      assert(c.size() == 2);
-      assert(c.contains(~p));
-      assert(c.contains(w.getBlocker()));
 
       assignVal = lState.value(w.getBlocker());
       if (assignVal == l_False)  // conflict found!
@@ -632,12 +845,32 @@ PropagateResult CoreSolver::propagateBinary(const Lit p)
       } else if (assignVal == l_Undef)
       {
          res.set(w, wIndex, i, false);
-         uncheckedEnqueue(w.getBlocker(), res.getVarSet());
+         uncheckedEnqueue(w.getBlocker(), lState.level(var(p)), res.getVarSet());
       }
    }
    return res;
 }
 
+inline int CoreSolver::findWatchCandidate(const BaseClause & c, const int begin, const int end, const Lit blocker) const
+{
+   if (c.size() < heuristic.simdSearchSize)
+      return LiteralSearch::findScalar(&c[0], begin, end, lState.state.data(), blocker);
+   else
+      return LiteralSearch::findNonFalse(&c[0], begin, end, lState.state.data(), blocker);
+}
+
+inline void CoreSolver::moveReason(const Watcher & w, const int listIndex, const int from, const int to)
+{
+   // literals kept on the trail by chronological backtracking are propagated again, so a reason in
+   // the compacted list has to follow its watcher
+   if (from != to)
+   {
+      AssignState & st = lState.state[var(w.getBlocker())];
+      if (st.wType == WatcherType::TWO && st.listPos == listIndex && st.watcherPos == static_cast<unsigned>(from))
+         st.watcherPos = to;
+   }
+}
+
 PropagateResult CoreSolver::propagateTwoWatched(const Lit p)
 {
    PropagateResult res;
@@ -654,29 +887,63 @@ PropagateResult CoreSolver::propagateTwoWatched(const Lit p)
          assert(dbState.twoWatched.isValidWatcher(w));
          assert(c.contains(~p));
          assert(c.contains(blocker));
-         k = 0;
-         for (; k < c.size(); k++)
-            if (c[k] != w.getBlocker() && lState.value(c[k]) != l_False)  // check if it can be a new watcher
-            {
-               assert(var(c[k]) != var(p));
-               assert(var(blocker) != var(c[k]));
-               assert(c.contains(c[k]));
-               //dbState.twoWatched.moveWatcher(listIndex,i, c[k]);
-               vec<Watcher> & wsNew = dbState.twoWatched.getWatcher(~c[k]);
-               dbState.twoWatched.getOtherWatcher(ws[i]).setBlocker(c[k], wsNew.size());
-               wsNew.push(w);
-               assert(dbState.twoWatched.isValidWatcher(wsNew.last()));
-               break;
-            }
+         Watcher & other = dbState.twoWatched.getOtherWatcher(ws[i]);
+         Watcher & posWatcher = (w.isHeader()) ? other : ws[i];
+         // check if a literal can be a new watcher, starting at the last successful position
+         int start = posWatcher.getSearchPos();
+         if (start >= c.size())
+            start = 0;
+         k = findWatchCandidate(c, start, c.size(), blocker);
+         if (k == c.size() && start > 0)
+         {
+            k = findWatchCandidate(c, 0, start, blocker);
+            if (k == start)
+               k = c.size();
+         }
 
-         if (k == c.size())
+         if (k < c.size())
+         {
+            assert(var(c[k]) != var(p));
+            assert(var(blocker) != var(c[k]));
+            assert(c.contains(c[k]));
+            //dbState.twoWatched.moveWatcher(listIndex,i, c[k]);
+            posWatcher.setSearchPos(k);
+            vec<Watcher> & wsNew = dbState.twoWatched.getWatcher(~c[k]);
+            dbState.twoWatched.markOccupied(dbState.twoWatched.getIndex(~c[k]), wsNew);
+            other.setBlocker(c[k], wsNew.size());
+            wsNew.push(w);
+            assert(dbState.twoWatched.isValidWatcher(wsNew.last()));
+         } else
          {
             if (lState.value(blocker) == l_Undef)
             {
+               const int level = lState.level(var(p));
+               if (level < lState.decisionLevel())
+               {
+                  // p is out of order on the trail: the implication level is the highest level of the false
+                  // literals, which has to be watched so the clause is visited again after backtracking
+                  int maxIdx = -1, maxLevel = level;
+                  for (int n = 0; n < c.size(); ++n)
+                     if (c[n] != blocker && lState.level(var(c[n])) > maxLevel)
+                     {
+                        maxIdx = n;
+                        maxLevel = lState.level(var(c[n]));
+                     }
+                  if (maxIdx >= 0)
+                  {
+                     vec<Watcher> & wsNew = dbState.twoWatched.getWatcher(~c[maxIdx]);
+                     dbState.twoWatched.markOccupied(dbState.twoWatched.getIndex(~c[maxIdx]), wsNew);
+                     other.setBlocker(c[maxIdx], wsNew.size());
+                     wsNew.push(w);
+                     res.set(w, dbState.twoWatched.getIndex(~c[maxIdx]), wsNew.size() - 1, false);
+                     uncheckedEnqueue(blocker, maxLevel, res.getVarSet());
+                     continue;
+                  }
+               }
                res.set(w, listIndex, j, false);
-               dbState.twoWatched.getOtherWatcher(ws[i]).setPos(j);
+               other.setPos(j);
                ws[j++] = ws[i];
-               uncheckedEnqueue(blocker, res.getVarSet());  // propagate other watched literal
+               uncheckedEnqueue(blocker, level, res.getVarSet());  // propagate other watched literal
             } else  // conflict found!
             {
                assert(lState.value(blocker) == l_False);
@@ -684,6 +951,7 @@ PropagateResult CoreSolver::propagateTwoWatched(const Lit p)
                for (; i < ws.size(); ++i, ++j)
                {
                   dbState.twoWatched.getOtherWatcher(ws[i]).setPos(j);
+                  moveReason(ws[i], listIndex, i, j);
                   ws[j] = ws[i];
                }
                lState.qhead = lState.trail.size();
@@ -692,6 +960,7 @@ PropagateResult CoreSolver::propagateTwoWatched(const Lit p)
       } else
       {
          dbState.twoWatched.getOtherWatcher(ws[i]).setPos(j);
+         moveReason(ws[i], listIndex, i, j);
          ws[j++] = ws[i];
       }
    }
@@ -722,7 +991,9 @@ PropagateResult CoreSolver::propagateOneWatched(const Lit p)
          for (; k < c.size(); k++)
             if (lState.value(c[k]) != l_False)  // check if it can be a new watcher
             {
-               dbState.oneWatched.getWatcher(~c[k]).push(oBin[i]);
+               vec<OneWatcher> & wsNew = dbState.oneWatched.getWatcher(~c[k]);
+               dbState.oneWatched.markOccupied(dbState.oneWatched.getIndex(~c[k]), wsNew);
+               wsNew.push(oBin[i]);
                oBin.unordered_remove(i);
                break;
             }
@@ -777,11 +1048,12 @@ void CoreSolver::resolveConflict(const PropagateResult & confl)
    vec<Lit> learnt_clause, selectors;
    unsigned int nblevels;
    assert(confl.getVarSet().isPropagated());
-   const BaseClause & c = getClause(confl.getVarSet());
-   assert(c.size() > 1);
+   assert(getClause(confl.getVarSet()).size() > 1);
 
 // CONFLICT
    ++statistic.nConflicts;
+   if (stable)
+      ++statistic.nStableConflicts;
    if (statistic.nConflicts % 5000 == 0 && heuristic.var_decay < heuristic.max_var_decay)
       heuristic.var_decay += 0.01;
 
@@ -791,22 +1063,72 @@ void CoreSolver::resolveConflict(const PropagateResult & confl)
       return;
    }
 
-   trailQueue.push(lState.trail.size());
+   trailAverage.update(lState.trail.size());
 // BLOCK RESTART (CP 2012 paper)
-   if (statistic.nConflicts > LOWER_BOUND_FOR_BLOCKING_RESTART && lbdQueue.isvalid() && lState.trail.size() > heuristic.R * trailQueue.getavg())
+   if (statistic.nConflicts > LOWER_BOUND_FOR_BLOCKING_RESTART && restartConflicts >= heuristic.sizeLBDQueue
+         && lState.trail.size() > heuristic.R * trailAverage.value())
    {
-      lbdQueue.fastclear();
+      restartConflicts = 0;
    }
 
    learnt_clause.clear();
 
+   // after chronological backtracking the conflict can be below the current decision level
+   int conflictLevel = 0, secondLevel = 0, numOnConflictLevel = 0;
+   Lit conflictLit = lit_Undef;
+   {
+      const ClauseView c = getClause(confl.getVarSet());
+      for (int i = 0; i < c.size(); ++i)
+      {
+         const int level = lState.level(var(c[i]));
+         if (level > conflictLevel)
+         {
+            secondLevel = conflictLevel;
+            conflictLevel = level;
+            conflictLit = c[i];
+            numOnConflictLevel = 1;
+         } else if (level == conflictLevel)
+            ++numOnConflictLevel;
+         else
+            secondLevel = std::max(secondLevel, level);
+      }
+   }
+   if (conflictLevel == 0)
+   {
+      setResult(l_False, "Unsatisfiable through level 0 conflict");
+      return;
+   }
+   if (heuristic.targetPhases || heuristic.modeSwitch || heuristic.rephaseInterval > 0)
+      lState.updatePhases(lState.trail_lim[conflictLevel - 1]);
+   cancelUntil(conflictLevel);
+
+   // a single literal on the conflict level is implied by the conflict clause on the second highest
+   // level of the clause, nothing has to be learnt when the literal is watched
+   if (numOnConflictLevel == 1)
+   {
+      const VarSet reason = getImplyingWatcher(confl.getVarSet(), conflictLit);
+      if (reason.isPropagated())
+      {
+         cancelUntil(secondLevel);
+         uncheckedEnqueue(conflictLit, secondLevel, reason);
+         cDb.notifyNewConflict(*this);
+         return;
+      }
+   }
+
    analyze(confl.getVarSet(), learnt_clause, backtrack_level, nblevels);
 //std::cout << "conflict (" << statistic.nConflicts << ") on clause " << confl << " from " << decisionLevel() << " to " << backtrack_level << std::endl;
-   lbdQueue.push(nblevels);
+   fastLbd.update(nblevels);
+   slowLbd.update(nblevels);
    statistic.sumLbd += nblevels;
-   cancelUntil(backtrack_level);
+   ++restartConflicts;
+   if (heuristic.chrono && learnt_clause.size() > 1 && statistic.nConflicts > heuristic.chronoConflicts
+         && lState.decisionLevel() - backtrack_level > heuristic.chronoDistance)
+      cancelUntil(lState.decisionLevel() - 1);
+   else
+      cancelUntil(backtrack_level);
    assert(backtrack_level > 0 || learnt_clause.size() == 1);
-   uncheckedEnqueue(learnt_clause[0], cDb.addClause(*this, learnt_clause, nblevels));
+   uncheckedEnqueue(learnt_clause[0], backtrack_level, cDb.addClause(*this, learnt_clause, nblevels));
    if (lState.reason(var(learnt_clause[0])).isPropagated())
       assert(getClause(lState.reason(var(learnt_clause[0]))).size() == learnt_clause.size());
    lState.varDecayActivity(heuristic);
@@ -814,24 +1136,229 @@ void CoreSolver::resolveConflict(const PropagateResult & confl)
    cDb.notifyNewConflict(*this);
 }
 
+// Returns the watcher of the conflict clause that implies the watched literal l of the clause, the
+// result is not propagated when l is not watched.
+//
+VarSet CoreSolver::getImplyingWatcher(const VarSet & confl, const Lit l) const
+{
+   VarSet res;
+   if (confl.getWatcherType() == WatcherType::TWO)
+   {
+      const Watcher & w = dbState.twoWatched.getWatcher(confl);
+      if (w.getBlocker() == l)
+         res = confl;
+      else if (confl.getWatchedLit() == l)
+         res = VarSet::create(WatcherType::TWO, dbState.twoWatched.getIndex(~w.getBlocker()), w.getBlockerRef());
+   } else if (confl.getWatcherType() == WatcherType::BINARY)
+   {
+      const Lit other = dbState.binWatched.getFirstLit(confl);
+      if (other == l)
+         res = confl;
+      else if (confl.getWatchedLit() == l)
+      {
+         // binary watchers do not know their partner, it is searched in the list of the other literal
+         const vec<BinaryWatcher> & ws = dbState.binWatched.getWatcher(~other);
+         for (int i = 0; i < ws.size() && !res.isPropagated(); ++i)
+            if (ws[i].getBlocker() == l)
+               res = VarSet::create(WatcherType::BINARY, dbState.binWatched.getIndex(~other), i);
+      }
+   }
+   return res;
+}
+
 bool CoreSolver::shouldRestart() const
 {
-   if(heuristic.luby)
+   if (heuristic.modeSwitch ? stable : heuristic.luby)
       return statistic.nConflicts >= lubyConflictlimit;
    else
-   return lbdQueue.isvalid() && ((lbdQueue.getavg() * heuristic.K) > (statistic.sumLbd / statistic.nConflicts));
+   return restartConflicts >= heuristic.sizeLBDQueue && fastLbd.value() * heuristic.K > slowLbd.value();
+}
+
+// Decisions that are more active than the next decision variable would be taken again right after
+// a complete restart, so their levels are kept.
+int CoreSolver::reusedTrailLevel()
+{
+   const Var next = lState.nextDecisionVar();
+   if (next == var_Undef)
+      return 0;
+
+   int level = 0;
+   while (level < lState.decisionLevel() && lState.preferredOver(var(lState.getDecision(level + 1)), next))
+      ++level;
+   return level;
 }
 
 void CoreSolver::restart()
 {
-   lbdQueue.fastclear();
-   int bt = 0;
-   cancelUntil(bt);
+   restartConflicts = 0;
+   // new phases or a new search mode make the kept decisions obsolete
+   const bool newPhases = statistic.nConflicts >= nextRephase;
+   const bool newMode = shouldSwitchMode();
+   const bool newSetting = requestedSetting != setting;
+   const int bt = (heuristic.reuseTrail && !newPhases && !newMode && !newSetting && !cDb.needsRootRestart(*this)) ? reusedTrailLevel() : 0;
+   binImplications.clear();
    statistic.nRestarts++;
-   cDb.notifyRestart(*this);
-   if(heuristic.luby)
+   if (newMode)
+      switchMode();
+   if (bt > 0)
+   {
+      cancelUntil(bt);
+      ++statistic.nReusedTrails;
+      statistic.nReusedLevels += bt;
+      cDb.notifyPartialRestart(*this);
+   } else
+   {
+      cancelUntil(0);
+      cDb.notifyRestart(*this);
+      if (newSetting)
+         applyRequestedSetting();
+      if (newPhases)
+         rephase();
+   }
+   if (stable)
+   {
+      ++statistic.nStableRestarts;
+      lubyConflictlimit = statistic.nConflicts + luby(2, statistic.nStableRestarts) * 100;
+   } else if(heuristic.luby)
       lubyConflictlimit += luby(2, statistic.nRestarts)*100;
 }
+
+// The new setting starts in focused mode with fresh restart limits, the phases, activities and
+// learnt clauses are kept.
+//
+void CoreSolver::applyRequestedSetting()
+{
+   SolverConfiguration::reconfigure(*this, requestedSetting);
+   stable = false;
+   if (modeBudget > 0)
+      nextModeSwitch = statistic.nPropagations + modeBudget;
+   lubyConflictlimit = statistic.nConflicts;
+   restartConflicts = 0;
+   ++statistic.nReconfigurations;
+}
+
+bool CoreSolver::shouldSwitchMode() const
+{
+   if (!heuristic.modeSwitch)
+      return false;
+   else if (modeBudget == 0)
+      return statistic.nConflicts >= heuristic.modeInitConflicts;
+   else
+      return statistic.nPropagations >= nextModeSwitch;
+}
+
+// The modes are measured in propagations instead of conflicts, because the conflicts of the
+// stable mode are much more expensive.
+//
+void CoreSolver::switchMode()
+{
+   if (modeBudget == 0)
+      modeBudget = std::max<uint64_t>(1, statistic.nPropagations);
+   else if (stable)
+      modeBudget *= heuristic.modeGrowth;
+   stable = !stable;
+   nextModeSwitch = statistic.nPropagations + modeBudget;
+   ++statistic.nModeSwitches;
+}
+// Resets the phases with the next entry of the schedule of this solver. The intervals grow
+// arithmetically, so later phases have more time to guide the search.
+//
+void CoreSolver::rephase()
+{
+   const char * schedule = heuristic.rephaseSchedule;
+   const char phase = schedule[statistic.nRephases % std::strlen(schedule)];
+   if (phase == 'S' && cDb.getWalkPhases(walkPhases))
+   {
+      for (Var v = 0; v < lState.nVars(); ++v)
+         lState.state[v].polarity = walkPhases[v];
+   } else if (phase == 'W' || phase == 'S')
+      walk();
+   lState.rephase(phase);
+   ++statistic.nRephases;
+   nextRephase = statistic.nConflicts + heuristic.rephaseInterval * (statistic.nRephases + 1);
+}
+
+// Local search from the saved phases on the permanent clauses, the others are implied by them.
+// The flips are bounded relative to the propagations since the last walk. The best assignment
+// becomes the saved phases, a satisfying one is decided immediately.
+//
+void CoreSolver::walk()
+{
+   if (!propagateRootLevel())
+      return;
+   const uint64_t flips = (heuristic.walker ? heuristic.walkerEffort : heuristic.walkEffort) * (statistic.nPropagations - walkPropagations);
+   walkPropagations = statistic.nPropagations;
+
+   LocalSearch ls(lState.nVars());
+   vec<Lit> c;
+   auto addClause = [this, &ls, &c]()
+   {
+      int j = 0;
+      for (int i = 0; i < c.size(); ++i)
+         if (lState.value(c[i]) == l_True)
+            return;
+         else if (lState.value(c[i]) == l_Undef)
+            c[j++] = c[i];
+      c.shrink(c.size() - j);
+      ls.addClause(c);
+   };
+   // binary clauses are in the lists of both negated literals
+   for (int i = 0; i < dbState.binWatched.size(); ++i)
+   {
+      Lit p;
+      p.x = i;
+      const vec<BinaryWatcher> & ws = dbState.binWatched.getWatcher(p);
+      for (int j = 0; j < ws.size(); ++j)
+         if (~p < ws[j].getBlocker())
+         {
+            c.clear();
+            c.push(~p);
+            c.push(ws[j].getBlocker());
+            addClause();
+         }
+   }
+   const vec<CRef> crefs = dbState.twoWatched.getAllCRefs();
+   for (int i = 0; i < crefs.size(); ++i)
+   {
+      const BaseClause & cl = cDb.getBuckets().getClause(crefs[i]);
+      if (cl.isPermanentClause())
+      {
+         c.clear();
+         for (int j = 0; j < cl.size(); ++j)
+            c.push(cl[j]);
+         addClause();
+      }
+   }
+
+   walkPhases.growTo(lState.nVars());
+   for (Var v = 0; v < lState.nVars(); ++v)
+      walkPhases[v] = lState.state[v].polarity;
+   const int numFalsified = ls.walk(walkPhases, flips, lState.rg);
+   ++statistic.nWalks;
+   statistic.nWalkFlips += ls.getFlips();
+   for (Var v = 0; v < lState.nVars(); ++v)
+      lState.state[v].polarity = walkPhases[v];
+   if (heuristic.walker)
+      cDb.publishWalkPhases(walkPhases, numFalsified);
+
+   if (numFalsified == 0)
+   {
+      for (Var v = 0; v < lState.nVars(); ++v)
+         if (lState.value(v) == l_Undef)
+         {
+            lState.newDecisionLevel();
+            uncheckedEnqueue(mkLit(v, walkPhases[v]), VarSet::decision());
+            if (propagate().isConflict())
+            {
+               assert(false);  // the permanent clauses imply all others
+               cancelUntil(0);
+               return;
+            }
+         }
+      setResult(l_True, "Solution through local search");
+   }
+}
+
 void CoreSolver::addDecision()
 {
    // New variable decision:
@@ -850,19 +1377,27 @@ void CoreSolver::addDecision()
 }
 
 void CoreSolver::uncheckedEnqueue(const Lit p, const VarSet & from, const bool imported)
+{
+   uncheckedEnqueue(p, lState.decisionLevel(), from, imported);
+}
+
+void CoreSolver::uncheckedEnqueue(const Lit p, const int level, const VarSet & from, const bool imported)
 {
    assert(lState.value(p) == l_Undef && from.getWatcherType() != WatcherType::ONE);
+   assert(level <= lState.decisionLevel());
    const int varP = var(p);
    lState.state[varP].assign = lbool(!sign(p));
-   lState.state[varP].set((lState.decisionLevel() == 0) ? VarSet() : from, lState.decisionLevel());
+   lState.state[varP].set((level == 0) ? VarSet() : from, level);
    lState.trail.push_(p);
-   if (!imported && lState.decisionLevel() == 0)
+   if (lState.branching == Branching::LRB)
+      lState.lrbAssigned(varP, statistic.nConflicts);
+   if (!imported && level == 0)
    {
       ++statistic.nUnit;
       //lState.newUnits.push(p);
       cDb.addUnit(*this, p);
    }
-   assert(from.isValid() || (lState.decisionLevel() == 0 && lState.level(p) == 0));
+   assert(from.isValid() || level == 0);
    assert(!lState.reason(var(p)).isPropagated() || p != lState.getDecision(lState.decisionLevel()));
 }
 
@@ -888,6 +1423,103 @@ bool CoreSolver::enqueue(const Lit p, const VarSet & from)
  |    all variables are decision variables, this means that the clause set is satisfiable. 'l_False'
  |    if the clause set is unsatisfiable. 'l_Undef' if the bound on number of conflicts is reached.
  |________________________________________________________________________________________________@*/
+// Propagates the units before the first decision, false when they are conflicting.
+//
+bool CoreSolver::propagateRootLevel()
+{
+   assert(lState.decisionLevel() == 0);
+   const PropagateResult confl = propagate();
+   if (confl.isConflict())
+   {
+      resolveConflict(confl);
+      return false;
+   }
+   return true;
+}
+
+// Decides all variables in index order (odd strategies: reversed) with the polarity false, true or
+// the one of most occurrences (strategy / 2) and propagates after each decision. The strategy fails
+// with the first conflict, then the solver is back on level 0.
+//
+bool CoreSolver::tryLuckyAssignment(const int strategy)
+{
+   const bool backward = strategy % 2 == 1;
+   const int polarity = strategy / 2;
+   const int n = lState.nVars();
+   for (int i = 0; i < n; ++i)
+   {
+      const Var v = backward ? n - 1 - i : i;
+      if (lState.value(v) != l_Undef)
+         continue;
+      const bool negative = polarity == 0 || (polarity == 2 && luckyOccurrences[v] < 0);
+      lState.newDecisionLevel();
+      uncheckedEnqueue(mkLit(v, negative), VarSet::decision());
+      if (propagate().isConflict())
+      {
+         cancelUntil(0);
+         return false;
+      }
+   }
+   return true;
+}
+
+// Runs the lucky strategies of this thread before the search. The saved phases are restored when
+// none of them satisfies the formula.
+//
+bool CoreSolver::tryLuckyAssignments()
+{
+   vec<char> polarity(lState.nVars());
+   for (int i = 0; i < polarity.size(); ++i)
+      polarity[i] = lState.state[i].polarity;
+
+   bool res = false;
+   const int numThreads = cDb.getNumSolverThreads();
+   for (int i = dbState.threadId; i < NumLuckyStrategies && !res && !cDb.jobFinished(); i += numThreads)
+      res = tryLuckyAssignment(i);
+
+   if (res)
+      setResult(l_True, "Solution through lucky assignment");
+   else
+      for (int i = 0; i < polarity.size(); ++i)
+         lState.state[i].polarity = polarity[i];
+   luckyOccurrences.clear(true);
+   return res;
+}
+
+// Decides the variables in activity order with their saved phase and propagates without conflict
+// analysis. A conflicting decision is flipped once, a second conflict ends the warmup. The reached
+// assignment becomes the initial phases. The activities are random per thread, so each thread
+// breaks the ties differently and derives its own phases.
+//
+void CoreSolver::warmup()
+{
+   Lit next;
+   while ((next = pickBranchLit()) != lit_Undef && !cDb.jobFinished())
+   {
+      lState.newDecisionLevel();
+      uncheckedEnqueue(next, VarSet::decision());
+      if (propagate().isConflict())
+      {
+         cancelUntil(lState.decisionLevel() - 1);
+         lState.newDecisionLevel();
+         uncheckedEnqueue(~next, VarSet::decision());
+         if (propagate().isConflict())
+            break;
+      }
+   }
+   if (next == lit_Undef)
+   {
+      setResult(l_True, "Solution through warmup");
+      return;
+   }
+   if (lState.decisionLevel() > 0)
+   {
+      for (int i = lState.trail_lim[0]; i < lState.trail.size(); ++i)
+         lState.state[var(lState.trail[i])].polarity = sign(lState.trail[i]);
+      cancelUntil(0);
+   }
+}
+
 lbool CoreSolver::search()
 {
 
@@ -899,6 +1531,9 @@ lbool CoreSolver::search()
       if (confl.isConflict())
       {
          resolveConflict(confl);
+         // a conflict on level 0 ends the search, also when it was found above level 0
+         if (result != l_Undef)
+            break;
          if (heuristic.conflict_budget < statistic.nConflicts)
             setResult(l_Undef, "Conflict budget reached");
       }
@@ -918,7 +1553,18 @@ lbool CoreSolver::solve()  // Parameters are useless in core but useful for Simp
    conflict.clear();
 
    cDb.notifySolverStart(*this);
+   lState.initBranching(heuristic);
 
+   if ((heuristic.lucky || heuristic.warmup) && result == l_Undef && propagateRootLevel())
+   {
+      if (heuristic.lucky)
+         tryLuckyAssignments();
+      if (heuristic.warmup && result == l_Undef)
+         warmup();
+   }
+   lState.initPhases();
+   if (heuristic.rephaseInterval > 0 && heuristic.rephaseSchedule[0] != '\0')
+      nextRephase = heuristic.rephaseInterval;
 // Search:
    res = search();
 
@@ -77,15 +77,56 @@ copies or substantial portions of the Software;
 #include "shared/ClauseWatcher.h"
 #include "shared/PropagateResult.h"
 #include "shared/SolverConfiguration.h"
+#include "shared/BinaryImplicationCache.h"
+#include "shared/MovingAverage.h"
 #include "glucose/simp/SimpSolver.h"
 
 #include <limits>
+#include <atomic>
 
 namespace Sticky
 {
 using Glucose::SimpSolver;
 class ClauseDatabase;
 
+// Read only view on a reason or conflict clause. Binary clauses are only stored in the watch
+// lists, so their two literals are held by the view itself.
+class ClauseView
+{
+ public:
+   explicit ClauseView(const BaseClause & c)
+         : c(&c),
+           bin { lit_Undef, lit_Undef }
+   {
+   }
+   ClauseView(const Lit & a, const Lit & b)
+         : c(nullptr),
+           bin { a, b }
+   {
+   }
+
+   inline int size() const
+   {
+      return (c == nullptr) ? 2 : c->size();
+   }
+   inline const Lit & operator[](const int & i) const
+   {
+      return (c == nullptr) ? bin[i] : (*c)[i];
+   }
+   inline bool isBinary() const
+   {
+      return c == nullptr;
+   }
+   inline bool isPermanentClause() const
+   {
+      return c == nullptr || c->isPermanentClause();
+   }
+
+ private:
+   const BaseClause * c;
+   Lit bin[2];
+};
+
 //=================================================================================================
 // Solver -- the main class:
 
@@ -112,8 +153,7 @@ class CoreSolver
    // Variable mode:
    //
 
-   unsigned int computeLBD(const vec<Lit> & lits);
-   unsigned int computeLBD(const BaseClause &c);
+   unsigned int sizeAdjustedLBD(const int nblevels, const int size) const;
 
    lbool getResult() const;
    void setResult(const lbool res, const std::string & msg = "");
@@ -134,17 +174,26 @@ class CoreSolver
    const SolverHeuristic & getHeuristic() const;
    SolverHeuristic & getHeuristic();
 
+   // Asks the solver to switch to another portfolio setting on its next restart, thread safe
+   void requestSetting(const unsigned setting);
+   unsigned getSetting() const;
+
    void cancelUntil(const int level);             // Backtrack until a certain level.
    Lit pickBranchLit();                   // Return the next decision variable.
    void findDecisionClauseForPropagation(Lit p, vec<Lit>& out_conflict);
    bool findDecisionClauseForConflict(const VarSet & confl, vec<Lit>& out_conflict, const CRef excludeRef = CRef_Undef);
    void analyze(const VarSet & confl, vec<Lit>& out_learnt, int& out_btlevel, unsigned int &nblevels);    // (bt = backtrack)
-   bool litRedundant(const Lit p, const uint32_t abstract_levels);  // (helper method for 'analyze()')
+   bool litRedundant(const Lit p);  // (helper method for 'analyze()')
+   void shrinkLearnt(vec<Lit> & out_learnt);  // (helper method for 'analyze()')
+   Lit findBlockUIP(const vec<Lit> & out_learnt, const int begin, const int end);
    PropagateResult propagate();  // Perform unit propagation. Returns possibly conflicting clause.
    void resolveConflict(const PropagateResult & confl);
+   VarSet getImplyingWatcher(const VarSet & confl, const Lit l) const;
 
    bool enqueue(const Lit p, const VarSet & from);
    void uncheckedEnqueue(const Lit p, const VarSet & from, const bool imported = false);  // Enqueue a literal. Assumes value of literal is undefined.
+   void uncheckedEnqueue(const Lit p, const int level, const VarSet & from, const bool imported = false);  // Enqueue a literal implied at a lower level.
+   void strengthenOtfsClauses();
 
  protected:
 
@@ -155,21 +204,63 @@ class CoreSolver
    unsigned int lbdRoundCounter;
    bool reduceOnSize;
    uint64_t lubyConflictlimit;
+   uint64_t nextRephase;  // number of conflicts after which the next restart resets the phases
+   bool stable;  // stable search mode: Luby restarts and target phases
+   uint64_t modeBudget;  // propagations per search mode, 0 until the first mode switch
+   uint64_t nextModeSwitch;  // number of propagations after which the next restart switches the mode
+   uint64_t walkPropagations;  // number of propagations at the last local search
+   std::atomic<unsigned> setting;  // portfolio setting of the SolverConfiguration
+   std::atomic<unsigned> requestedSetting;  // setting applied on the next restart when it differs
    int reduceOnSizeSize;                // See XMinisat paper
    vec<unsigned int> permDiff;  // permDiff[var] contains the current conflict number... Used to count the number of  LBD
    // UPDATEVARACTIVITY trick (see competition'09 companion paper)
    vec<Lit> lastDecisionLevel;
 
+   // States of 'seen' during conflict analysis. Removable and failed literals are cached for all
+   // minimization calls of one conflict.
+   enum SeenState : char
+   {
+      SeenUndef = 0,
+      SeenSource = 1,
+      SeenRemovable = 2,
+      SeenFailed = 3,
+      SeenBlock = 4
+   };
+   struct AnalyzeStackElem
+   {
+      int i;
+      Lit l;
+   };
+
    vec<char> seen;
-   vec<Lit> analyze_stack;
+   vec<int> levelCount;  // number of literals per level in the learnt clause during minimization
+   vec<Lit> keptLits;  // lower level literals kept on the trail by chronological backtracking
+   vec<int> luckyOccurrences;  // positive minus negative occurrences of each variable, only used before the search
+   static constexpr int NumLuckyStrategies = 6;
+   // reason clauses found to be subsumed by a resolvent, they are strengthened at the next restart
+   struct OtfsClause
+   {
+      CRef cref;
+      int begin;
+      int end;
+   };
+   static constexpr int OtfsMaxClauses = 1024;
+   vec<OtfsClause> otfsClauses;
+   vec<Lit> otfsLits;
+   vec<char> walkPhases;
+   vec<AnalyzeStackElem> analyze_stack;
+   vec<Lit> analyze_block;
    vec<Lit> analyze_toclear;
 
-   // Used for restart strategies
-   bqueue<unsigned int> trailQueue;
-   bqueue<unsigned int> lbdQueue;  // Bounded queues for restarts.
-
    SolverHeuristic heuristic;
    SolverStatistic statistic;
+   BinaryImplicationCache binImplications;  // refreshed on restarts
+
+   // Used for restart strategies
+   MovingAverage trailAverage;
+   MovingAverage fastLbd;
+   MovingAverage slowLbd;
+   uint64_t restartConflicts;  // conflicts since the last restart or blocked restart
 
    // State variables
    ClauseDatabase & cDb;
@@ -181,20 +272,34 @@ class CoreSolver
    vec<lbool> model;  // If problem is satisfiable, this vector contains the model (if any).
    vec<Lit> conflict;  // If problem is unsatisfiable (possibly under assumptions),
 
-   const BaseClause & getClause(const VarSet & vs) const;
-   const BaseClause & getClause(const Var v) const;
+   int stampLevel(const int level);
+   ClauseView getClause(const VarSet & vs) const;
+   ClauseView getClause(const Var v) const;
 
    PropagateResult propagateBinary(const Lit l);
    PropagateResult propagateTwoWatched(const Lit l);
+   void moveReason(const Watcher & w, const int listIndex, const int from, const int to);
+   int findWatchCandidate(const BaseClause & c, const int begin, const int end, const Lit blocker) const;
    PropagateResult propagateOneWatched(const Lit l);
 
+   bool propagateRootLevel();
+   bool tryLuckyAssignments();
+   bool tryLuckyAssignment(const int strategy);
+   void warmup();
    lbool search();
 
    bool shouldRestart() const;
+   bool shouldSwitchMode() const;
+   void switchMode();
+   int reusedTrailLevel();
+   void rephase();
+   void walk();
    void restart();
+   void applyRequestedSetting();
    void addDecision();
 
    void minimisationWithBinaryResolution(vec<Lit> &out_learnt);
+   void addOtfsClause(const VarSet & reason, const ClauseView & c, const Lit p);
 
 };
 
@@ -244,6 +349,15 @@ inline SolverStatistic & CoreSolver::getStatistic()
    return statistic;
 }
 
+inline void CoreSolver::requestSetting(const unsigned s)
+{
+   requestedSetting = s;
+}
+inline unsigned CoreSolver::getSetting() const
+{
+   return setting;
+}
+
 inline const SolverHeuristic & CoreSolver::getHeuristic() const
 {
    return heuristic;
@@ -81,9 +81,13 @@ DatabaseThreadState::DatabaseThreadState(const uint32_t & threadId, const unsign
         restartFactor(1),
         crefBuffer(),
         litBuffer(),
+        recentCRefs(),
+        recentPos(0),
+        litStamps(2 * numLits, 0),
+        litStamp(0),
         twoWatched(cba,numLits),
         oneWatched(cba,numLits),
-        binWatched(cba,numLits)
+        binWatched(numLits)
 {
 }
 
@@ -98,6 +98,10 @@ struct DatabaseThreadState
       vec<std::tuple<CRef,CRef>> deleteRefs;
       vec<LearntCRef> crefBuffer;
       vec<Lit> litBuffer;
+      vec<CRef> recentCRefs;  // ring of the last private learnt clauses, invalid after a reduce
+      uint32_t recentPos;
+      vec<uint32_t> litStamps;
+      uint32_t litStamp;
       TwoWatcherLists twoWatched;
       OneWatcherLists oneWatched;
       BinaryWatcherLists binWatched;
@@ -68,6 +68,7 @@ copies or substantial portions of the Software;
 #include "shared/SharedTypes.h"
 
 #include <limits>
+#include <algorithm>
 
 using namespace Glucose;
 
@@ -93,6 +94,44 @@ extern DoubleOption opt_random_seed;
 extern IntOption opt_ccmin_mode;
 extern IntOption opt_phase_saving;
 extern BoolOption opt_rnd_init_act;
+
+const char* _search = "SEARCH";
+IntOption opt_simd_search_size(_search, "simdSearchSz", "Minimal clause size for which a new watched literal is searched with AVX2/AVX-512 (0 = scalar search only)", 16,
+                               IntRange(0, std::numeric_limits<int32_t>::max()));
+IntOption opt_chrono_distance(_search, "chrono", "Backtrack chronologically when the backjump skips more than this number of levels (-1 = never)", 100,
+                              IntRange(-1, std::numeric_limits<int32_t>::max()));
+IntOption opt_chrono_conflicts(_search, "chronoAfter", "Number of conflicts before chronological backtracking is used", 4000,
+                               IntRange(0, std::numeric_limits<int32_t>::max()));
+IntOption opt_minimize_depth(_search, "minDepth", "Maximal recursion depth of the deep learnt clause minimization", 1000,
+                             IntRange(1, std::numeric_limits<int32_t>::max()));
+IntOption opt_max_binary_implications(_search, "binImpl", "Maximal number of transitive binary implications per literal used to minimize learnt clauses", 64,
+                                      IntRange(0, std::numeric_limits<int32_t>::max()));
+BoolOption opt_shrink(_search, "shrink", "Shrink learnt clauses by replacing the literals of a level with their block level UIP", true);
+BoolOption opt_otfs(_search, "otfs", "Strengthen reason clauses that are subsumed by a resolvent during conflict analysis", true);
+IntOption opt_branching(_search, "branching", "Decision heuristic of all solvers (-1 = mixed portfolio, 0 = VSIDS, 1 = VMTF, 2 = LRB)", -1, IntRange(-1, 2));
+IntOption opt_target_phases(_search, "targetPhase", "Decide with the phases of the largest conflict free trail (-1 = mixed portfolio, 0 = off, 1 = on)", -1, IntRange(-1, 1));
+IntOption opt_rephase_interval(_search, "rephaseInt", "Base conflict interval of the rephasing, it grows arithmetically (0 = never)", 1000,
+                               IntRange(0, std::numeric_limits<int32_t>::max()));
+StringOption opt_rephase_schedule(_search, "rephaseSched", "Order of the reset phases: O(riginal), I(nverted), B(est), R(andom), W(alk), S(hared walk) (default: mixed portfolio)");
+DoubleOption opt_walk_effort(_search, "walkEffort", "Local search flips per propagation since the last walk of a rephasing", 0.2,
+                             DoubleRange(0, true, std::numeric_limits<double>::max(), true));
+IntOption opt_walkers(_search, "walkers", "Number of solvers that work mainly as local search and share their phases (-1 = one of at least 8 solvers)", -1,
+                      IntRange(-1, std::numeric_limits<int32_t>::max()));
+DoubleOption opt_walker_effort(_search, "walkerEffort", "Local search flips per propagation of the local search workers", 4.0,
+                               DoubleRange(0, true, std::numeric_limits<double>::max(), true));
+IntOption opt_mode_switch(_search, "modeSwitch", "Alternate between focused and stable search (-1 = mixed portfolio, 0 = off, 1 = on)", -1, IntRange(-1, 1));
+IntOption opt_mode_init(_search, "modeInit", "Number of conflicts of the first focused search, its propagations are the budget of the next modes", 1000,
+                        IntRange(1, std::numeric_limits<int32_t>::max()));
+DoubleOption opt_mode_growth(_search, "modeGrowth", "Growth of the propagation budget of the search modes per focused and stable pair", 2.0,
+                             DoubleRange(1, true, std::numeric_limits<double>::max(), true));
+IntOption opt_size_slow_lbd_queue(_search, "szSlowLBDQueue", "The window of the slow moving average of the LBD for restarts", 100000,
+                                  IntRange(10, std::numeric_limits<int32_t>::max()));
+IntOption opt_core_lbd(_search, "coreLbd", "Learnt clauses up to this lbd are never reduced", 2, IntRange(1, std::numeric_limits<int32_t>::max()));
+IntOption opt_tier2_lbd(_search, "tier2Lbd", "Learnt clauses up to this lbd are kept as long as they are used between two reduces", 6,
+                        IntRange(1, std::numeric_limits<int32_t>::max()));
+BoolOption opt_lucky(_search, "lucky", "Try cheap assignments of all variables with propagation before the search", true);
+BoolOption opt_warmup(_search, "warmup", "Initialize the phases by propagating decisions in activity order before the search", true);
+BoolOption opt_reuse_trail(_search, "reuseTrail", "Keep the decision levels on restarts that would be decided again immediately", true);
 // CLAUSE SHARING
 
 const char* _cs = "CLAUSE SHARING";
@@ -121,11 +160,18 @@ IntOption opt_conflict_budget(_cs, "clBudget", "Maximum number of conflicts in a
                                   IntRange(-1, std::numeric_limits<int32_t>::max()));
 
 IntOption opt_share_only_reused_clauses(_cs, "reusedOnly", "Shares clauses only when they are reused this many times", 2, IntRange(0, 100));
+IntOption opt_num_recent_subsumption(_cs, "subsRecent", "Number of recent private learnt clauses checked for subsumption by a new learnt clause", 8,
+                                     IntRange(0, std::numeric_limits<int32_t>::max()));
+IntOption opt_max_recent_subsumption_sz(_cs, "subsRecentSZ", "Maximal size of recent learnt clauses checked for subsumption", 40,
+                                        IntRange(0, std::numeric_limits<int32_t>::max()));
 // GARBAGE HEURISTIC
 const char* _sgc = "SHARED GARBAGE COLLECT";
 DoubleOption opt_garbage_frac_shared(_sgc, "sgc-frac-sh", "The fraction of wasted memory allowed before the garbage collection is triggered", 0.40,
                                      DoubleRange(0, false, 1, false));
 
+IntOption opt_max_gc_pause(_sgc, "sgc-pause", "Microseconds a solver spends at most in one garbage collection, the rest is continued on the next restart (0 = no limit)", 1000,
+                           IntRange(0, std::numeric_limits<int32_t>::max()));
+
 DoubleOption opt_frac_solver(_sgc, "sgc-frac-solver", "Portion of memory used for the solvers. Other part will be used for the clause database", 0.90,
                              DoubleRange(0, false, 1, false));
 
@@ -146,6 +192,8 @@ IntOption opt_maxmemory(_parallel, "maxmemory", "Maximum memory to use (in Mb)",
 IntOption opt_maxtime(_parallel, "maxtime", "Maximum system time to solve (in seconds, -1 for no software limit)", -1);
 IntOption opt_nbsolversmultithreads(_parallel, "nthreads", "Number of core threads", 2);
 DoubleOption opt_statsInterval(_parallel, "statsinterval", "Seconds (real time) between two stats reports", 5.0, DoubleRange(1.0, true, 10000.0, false));
+DoubleOption opt_reconfigure_interval(_parallel, "reconfInt", "Seconds (real time) between two reassignments of the weakest solver to another setting (0 = never)", 60.0,
+                                      DoubleRange(0.0, true, std::numeric_limits<double>::max(), true));
 IntOption opt_enforce_restart_after_reduces(_parallel, "enforceRestarts", "Number of shared reduces without enforcing delayed solver to restart", 4, IntRange(1, 1000));
 namespace Sticky
 {
@@ -153,6 +201,7 @@ SolverHeuristic::SolverHeuristic()
       : K(opt_K),
         R(opt_R),
         sizeLBDQueue(opt_size_lbd_queue),
+        sizeSlowLBDQueue(opt_size_slow_lbd_queue),
         sizeTrailQueue(opt_size_trail_queue),
         lbSizeMinimizingClause(opt_lb_size_minimzing_clause),
         lbLBDMinimizingClause(opt_lb_lbd_minimzing_clause),
@@ -166,13 +215,45 @@ SolverHeuristic::SolverHeuristic()
         random_var_freq(opt_random_var_freq),
         random_seed(opt_random_seed),
         ccmin_mode(opt_ccmin_mode),
+        minimizeDepth(opt_minimize_depth),
+        maxBinaryImplications(opt_max_binary_implications),
         phase_saving(opt_phase_saving),
         rnd_pol(false),
         rnd_init_act(opt_rnd_init_act),
         conflict_budget((opt_conflict_budget == -1) ? std::numeric_limits<decltype(conflict_budget)>::max() : opt_conflict_budget),
         propagation_budget(std::numeric_limits<decltype(propagation_budget)>::max()),
         chanseok(false),
-        luby(false)
+        luby(false),
+        modeSwitch(opt_mode_switch == 1),
+        portfolioModeSwitch(opt_mode_switch < 0),
+        modeInitConflicts(opt_mode_init),
+        modeGrowth(opt_mode_growth),
+        branching((opt_branching < 0) ? Branching::VSIDS : static_cast<Branching>(static_cast<int>(opt_branching))),
+        portfolioBranching(opt_branching < 0),
+        lrbStepSize(0.4),
+        lrbMinStepSize(0.06),
+        lrbStepDecay(1e-6),
+        targetPhases(opt_target_phases == 1),
+        portfolioTargetPhases(opt_target_phases < 0),
+        rephaseInterval(opt_rephase_interval),
+        rephaseSchedule((opt_rephase_schedule == nullptr) ? "BOBI" : static_cast<const char *>(opt_rephase_schedule)),
+        portfolioRephasing(opt_rephase_schedule == nullptr),
+        walkEffort(opt_walk_effort),
+        walker(false),
+        numWalkers(opt_walkers),
+        portfolioWalkers(opt_walkers < 0),
+        walkerEffort(opt_walker_effort),
+        coreLbd(opt_core_lbd),
+        tier2Lbd(std::max<int>(opt_core_lbd, opt_tier2_lbd)),
+        simdSearchSize((opt_simd_search_size == 0) ? std::numeric_limits<int>::max() : static_cast<int>(opt_simd_search_size)),
+        chrono(false),
+        chronoDistance(opt_chrono_distance),
+        chronoConflicts(opt_chrono_conflicts),
+        shrink(opt_shrink),
+        otfs(opt_otfs),
+        reuseTrail(opt_reuse_trail),
+        lucky(opt_lucky),
+        warmup(opt_warmup)
 {
 }
 
@@ -185,8 +266,10 @@ Sticky::DatabaseHeuristic::DatabaseHeuristic()
         maxAllocBytes(1024ULL * 1024ULL * opt_maxmemory),
         fracSolverMem(opt_frac_solver),
         outputInterval(opt_statsInterval),
+        reconfigureInterval(opt_reconfigure_interval),
         maxRuntime(opt_maxtime),
         garbageWasteFrac(opt_garbage_frac_shared),
+        maxGcPauseMicros(opt_max_gc_pause),
         cla_decay(opt_clause_decay)
 {
 }
@@ -210,6 +293,8 @@ Sticky::SharingHeuristic::SharingHeuristic()
         maxShareDirectSize(opt_max_good_sz),
         maxSharedSize(opt_max_shared_sz),
         numReusedBeforeSharing(opt_share_only_reused_clauses),
+        numRecentSubsumption(opt_num_recent_subsumption),
+        maxRecentSubsumptionSize(opt_max_recent_subsumption_sz),
         numCRefsExchangePerThread(opt_sz_learnt_ring_buffer),
         numUnaryExchangePerThread(opt_sz_unary_ring_buffer),
         viviSpendTolerance(opt_dynamic_vivi_tol)
@@ -75,12 +75,21 @@ copies or substantial portions of the Software;
 namespace Sticky
 {
 
+// Decision heuristics of the search
+enum class Branching : char
+{
+   VSIDS,
+   VMTF,
+   LRB
+};
+
 struct SolverHeuristic
 {
-   // Constants For restarts
+   // Constants For restarts, the sizes are the windows of the moving averages
    double K;
    double R;
    double sizeLBDQueue;
+   double sizeSlowLBDQueue;
    double sizeTrailQueue;
 
    // Constant for reducing clause
@@ -98,12 +107,77 @@ struct SolverHeuristic
    double random_var_freq;
    double random_seed;
    int ccmin_mode;  // Controls conflict clause minimization (0=none, 1=basic, 2=deep).
+   int minimizeDepth;  // Maximal recursion depth of the deep conflict clause minimization
+   int maxBinaryImplications;  // Maximal number of cached binary implications per literal for the minimization
    int phase_saving;  // Controls the level of phase saving (0=none, 1=limited, 2=full).
    bool rnd_pol;            // Use random polarities for branching heuristics.
    bool rnd_init_act;  // Initialize variable activities with a small random value.
    bool chanseok;
    bool luby;
 
+   // Alternate between focused search with glucose restarts and stable search with Luby restarts
+   // and target phases. The first focused mode ends after modeInitConflicts conflicts, its
+   // propagations are the budget of the following modes, growing by modeGrowth per mode pair.
+   bool modeSwitch;
+   bool portfolioModeSwitch;
+   uint64_t modeInitConflicts;
+   double modeGrowth;
+
+   // Decision heuristic, it is chosen per solver by the configuration unless fixed by an option
+   Branching branching;
+   bool portfolioBranching;
+   // step size of the learning rate branching, it decays per conflict down to the minimum
+   double lrbStepSize;
+   double lrbMinStepSize;
+   double lrbStepDecay;
+
+   // Decide with the phases of the largest conflict free trail since the last rephasing
+   bool targetPhases;
+   bool portfolioTargetPhases;
+   // Reset the saved phases on the restart after every rephaseInterval * n conflicts, cycling the
+   // schedule of O(riginal), I(nverted), B(est), R(andom), W(alk) and S(hared walk) phases.
+   // 0 disables rephasing.
+   uint64_t rephaseInterval;
+   const char * rephaseSchedule;
+   bool portfolioRephasing;
+
+   // Flips of the local search per propagation since the last walk
+   double walkEffort;
+   // Local search workers walk with walkerEffort and publish their best phases for the S rephasing
+   bool walker;
+   int numWalkers;
+   bool portfolioWalkers;
+   double walkerEffort;
+
+   // Tiers of the learnt clauses: up to coreLbd they are kept, up to tier2Lbd they are kept while
+   // used between two reduces, the others are reduced by lbd and activity
+   unsigned coreLbd;
+   unsigned tier2Lbd;
+
+   // Minimal clause size for the vectorized search of new watched literals
+   int simdSearchSize;
+
+   // Chronological backtracking: used when enabled for this solver, after chronoConflicts conflicts
+   // and when the backjump would skip more than chronoDistance levels
+   bool chrono;
+   int chronoDistance;
+   uint64_t chronoConflicts;
+
+   // Replace the literals of a lower level in learnt clauses by their block level UIP
+   bool shrink;
+
+   // Strengthen reason clauses that are subsumed by a resolvent of the conflict analysis
+   bool otfs;
+
+   // Restarts only backtrack to the first level whose decision is less active than the next decision
+   bool reuseTrail;
+
+   // Try fixed assignments of all variables before the search, the strategies are split among the threads
+   bool lucky;
+
+   // Derive the initial phases from an assignment propagated in activity order without conflict analysis
+   bool warmup;
+
    // Resource contraints:
    uint64_t conflict_budget;
    uint64_t propagation_budget;
@@ -121,8 +195,10 @@ struct DatabaseHeuristic
    uint64_t maxAllocBytes;
    double fracSolverMem;
    double outputInterval;
+   double reconfigureInterval;  // seconds between two reassignments of a solver setting, 0 disables them
    double maxRuntime;
    double garbageWasteFrac;
+   uint64_t maxGcPauseMicros;  // time limit of one garbage collection of a solver, 0 is unlimited
    double cla_decay;
 
    DatabaseHeuristic();
@@ -188,6 +264,8 @@ class SharingHeuristic
    int maxShareDirectSize;
    int maxSharedSize;
    unsigned numReusedBeforeSharing;
+   unsigned numRecentSubsumption;  // number of recent private learnt clauses checked for subsumption
+   int maxRecentSubsumptionSize;
    unsigned numCRefsExchangePerThread;
    unsigned numUnaryExchangePerThread;
    double viviSpendTolerance;
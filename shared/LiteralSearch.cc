@@ -0,0 +1,190 @@
+/***************************************************************************************[Solver.cc]
+
+ Sticky Sat -- Copyright (c) 2018-2019, Marc Hartung, Zuse Institute Berlin
+
+Sticky Sat sources are based on Glucose Syrup and is therefore also restricted by all
+copyright notices below.
+
+Sticky Sat sources are based on another copyright. Permissions and copyrights for the parallel
+version of Glucose-Syrup (the "Software") are granted, free of charge, to deal with the Software
+without restriction, including the rights to use, copy, modify, merge, publish, distribute,
+sublicence, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+- The above and below copyrights notices and this permission notice shall be included in all
+copies or substantial portions of the Software;
+
+--------------- Original Glucose Copyrights
+
+ Glucose -- Copyright (c) 2009-2014, Gilles Audemard, Laurent Simon
+ CRIL - Univ. Artois, France
+ LRI  - Univ. Paris Sud, France (2009-2013)
+ Labri - Univ. Bordeaux, France
+
+ Syrup (Glucose Parallel) -- Copyright (c) 2013-2014, Gilles Audemard, Laurent Simon
+ CRIL - Univ. Artois, France
+ Labri - Univ. Bordeaux, France
+
+ Glucose sources are based on MiniSat (see below MiniSat copyrights). Permissions and copyrights of
+ Glucose (sources until 2013, Glucose 3.0, single core) are exactly the same as Minisat on which it
+ is based on. (see below).
+
+ Glucose-Syrup sources are based on another copyright. Permissions and copyrights for the parallel
+ version of Glucose-Syrup (the "Software") are granted, free of charge, to deal with the Software
+ without restriction, including the rights to use, copy, modify, merge, publish, distribute,
+ sublicence, and/or sell copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ - The above and below copyrights notices and this permission notice shall be included in all
+ copies or substantial portions of the Software;
+ - The parallel version of Glucose (all files modified since Glucose 3.0 releases, 2013) cannot
+ be used in any competitive event (sat competitions/evaluations) without the express permission of
+ the authors (Gilles Audemard / Laurent Simon). This is also the case for any competitive event
+ using Glucose Parallel as an embedded SAT engine (single core or not).
+
+
+ --------------- Original Minisat Copyrights
+
+ Copyright (c) 2003-2006, Niklas Een, Niklas Sorensson
+ Copyright (c) 2007-2010, Niklas Sorensson
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ associated documentation files (the "Software"), to deal in the Software without restriction,
+ including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or
+ substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ **************************************************************************************************/
+
+#include "shared/LiteralSearch.h"
+
+#include <cstddef>
+#include <limits>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define STICKY_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace Sticky
+{
+
+const LiteralSearch::Kernel LiteralSearch::kernel = LiteralSearch::selectKernel();
+
+#ifdef STICKY_X86_SIMD
+
+// A literal is false, when the assignment of its variable xor its sign is exactly l_False (=1).
+// Undefined variables are stored as 2, so they never compare equal.
+__attribute__((target("avx2")))
+int LiteralSearch::findAvx2(const Lit * lits, int begin, const int end, const AssignState * state, const Lit skip)
+{
+   const int * base = reinterpret_cast<const int*>(reinterpret_cast<const char*>(state) + offsetof(AssignState, assign));
+   const __m256i stride = _mm256_set1_epi32(sizeof(AssignState));
+   const __m256i lowByte = _mm256_set1_epi32(0xFF);
+   const __m256i one = _mm256_set1_epi32(1);
+   const __m256i skipLit = _mm256_set1_epi32(toInt(skip));
+   for (; begin + 8 <= end; begin += 8)
+   {
+      const __m256i l = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lits + begin));
+      const __m256i offsets = _mm256_mullo_epi32(_mm256_srli_epi32(l, 1), stride);
+      const __m256i assign = _mm256_and_si256(_mm256_i32gather_epi32(base, offsets, 1), lowByte);
+      const __m256i value = _mm256_xor_si256(assign, _mm256_and_si256(l, one));
+      const __m256i rejected = _mm256_or_si256(_mm256_cmpeq_epi32(value, one), _mm256_cmpeq_epi32(l, skipLit));
+      const unsigned mask = ~static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(rejected))) & 0xFF;
+      if (mask != 0)
+         return begin + __builtin_ctz(mask);
+   }
+   return findScalar(lits, begin, end, state, skip);
+}
+
+__attribute__((target("avx512f")))
+int LiteralSearch::findAvx512(const Lit * lits, int begin, const int end, const AssignState * state, const Lit skip)
+{
+   const char * base = reinterpret_cast<const char*>(state) + offsetof(AssignState, assign);
+   const __m512i stride = _mm512_set1_epi32(sizeof(AssignState));
+   const __m512i lowByte = _mm512_set1_epi32(0xFF);
+   const __m512i one = _mm512_set1_epi32(1);
+   const __m512i skipLit = _mm512_set1_epi32(toInt(skip));
+   for (; begin + 16 <= end; begin += 16)
+   {
+      const __m512i l = _mm512_loadu_si512(lits + begin);
+      const __m512i offsets = _mm512_mullo_epi32(_mm512_srli_epi32(l, 1), stride);
+      const __m512i assign = _mm512_and_si512(_mm512_i32gather_epi32(offsets, base, 1), lowByte);
+      const __m512i value = _mm512_xor_si512(assign, _mm512_and_si512(l, one));
+      const unsigned mask = _mm512_cmpneq_epi32_mask(value, one) & _mm512_cmpneq_epi32_mask(l, skipLit);
+      if (mask != 0)
+         return begin + __builtin_ctz(mask);
+   }
+   return findAvx2(lits, begin, end, state, skip);
+}
+
+bool LiteralSearch::supportsAvx2()
+{
+   __builtin_cpu_init();
+   return __builtin_cpu_supports("avx2");
+}
+
+bool LiteralSearch::supportsAvx512()
+{
+   __builtin_cpu_init();
+   return __builtin_cpu_supports("avx512f") && supportsAvx2();
+}
+
+#else
+
+int LiteralSearch::findAvx2(const Lit * lits, int begin, const int end, const AssignState * state, const Lit skip)
+{
+   return findScalar(lits, begin, end, state, skip);
+}
+
+int LiteralSearch::findAvx512(const Lit * lits, int begin, const int end, const AssignState * state, const Lit skip)
+{
+   return findScalar(lits, begin, end, state, skip);
+}
+
+bool LiteralSearch::supportsAvx2()
+{
+   return false;
+}
+
+bool LiteralSearch::supportsAvx512()
+{
+   return false;
+}
+
+#endif
+
+bool LiteralSearch::isApplicable(const int nVars)
+{
+   return static_cast<uint64_t>(nVars) * sizeof(AssignState) < static_cast<uint64_t>(std::numeric_limits<int32_t>::max());
+}
+
+LiteralSearch::Kernel LiteralSearch::selectKernel()
+{
+   if (supportsAvx512())
+      return &findAvx512;
+   else if (supportsAvx2())
+      return &findAvx2;
+   else
+      return &findScalar;
+}
+
+const char * LiteralSearch::getKernelName()
+{
+   if (kernel == &findAvx512)
+      return "avx512";
+   else if (kernel == &findAvx2)
+      return "avx2";
+   else
+      return "scalar";
+}
+
+} /* namespace Sticky */
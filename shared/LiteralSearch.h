@@ -0,0 +1,121 @@
+/***************************************************************************************[Solver.cc]
+
+ Sticky Sat -- Copyright (c) 2018-2019, Marc Hartung, Zuse Institute Berlin
+
+Sticky Sat sources are based on Glucose Syrup and is therefore also restricted by all
+copyright notices below.
+
+Sticky Sat sources are based on another copyright. Permissions and copyrights for the parallel
+version of Glucose-Syrup (the "Software") are granted, free of charge, to deal with the Software
+without restriction, including the rights to use, copy, modify, merge, publish, distribute,
+sublicence, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+- The above and below copyrights notices and this permission notice shall be included in all
+copies or substantial portions of the Software;
+
+--------------- Original Glucose Copyrights
+
+ Glucose -- Copyright (c) 2009-2014, Gilles Audemard, Laurent Simon
+ CRIL - Univ. Artois, France
+ LRI  - Univ. Paris Sud, France (2009-2013)
+ Labri - Univ. Bordeaux, France
+
+ Syrup (Glucose Parallel) -- Copyright (c) 2013-2014, Gilles Audemard, Laurent Simon
+ CRIL - Univ. Artois, France
+ Labri - Univ. Bordeaux, France
+
+ Glucose sources are based on MiniSat (see below MiniSat copyrights). Permissions and copyrights of
+ Glucose (sources until 2013, Glucose 3.0, single core) are exactly the same as Minisat on which it
+ is based on. (see below).
+
+ Glucose-Syrup sources are based on another copyright. Permissions and copyrights for the parallel
+ version of Glucose-Syrup (the "Software") are granted, free of charge, to deal with the Software
+ without restriction, including the rights to use, copy, modify, merge, publish, distribute,
+ sublicence, and/or sell copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ - The above and below copyrights notices and this permission notice shall be included in all
+ copies or substantial portions of the Software;
+ - The parallel version of Glucose (all files modified since Glucose 3.0 releases, 2013) cannot
+ be used in any competitive event (sat competitions/evaluations) without the express permission of
+ the authors (Gilles Audemard / Laurent Simon). This is also the case for any competitive event
+ using Glucose Parallel as an embedded SAT engine (single core or not).
+
+
+ --------------- Original Minisat Copyrights
+
+ Copyright (c) 2003-2006, Niklas Een, Niklas Sorensson
+ Copyright (c) 2007-2010, Niklas Sorensson
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ associated documentation files (the "Software"), to deal in the Software without restriction,
+ including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or
+ substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ **************************************************************************************************/
+
+#ifndef SHARED_LITERALSEARCH_H_
+#define SHARED_LITERALSEARCH_H_
+
+#include "shared/SharedTypes.h"
+#include "shared/LiteralSetting.h"
+
+namespace Sticky
+{
+
+/*
+ * Search for a new watched literal in long clauses. The literal value table (LiteralSetting::state)
+ * is gathered with AVX2 or AVX-512 when the cpu supports it, otherwise the scalar loop is used.
+ * The kernel is selected once at startup.
+ */
+class LiteralSearch
+{
+ public:
+   typedef int (*Kernel)(const Lit * lits, int begin, const int end, const AssignState * state, const Lit skip);
+
+   // returns the position of the first literal in [begin, end) which is not false and not 'skip', or 'end' if none exists
+   static int findNonFalse(const Lit * lits, const int begin, const int end, const AssignState * state, const Lit skip);
+
+   static int findScalar(const Lit * lits, int begin, const int end, const AssignState * state, const Lit skip);
+   static int findAvx2(const Lit * lits, int begin, const int end, const AssignState * state, const Lit skip);
+   static int findAvx512(const Lit * lits, int begin, const int end, const AssignState * state, const Lit skip);
+
+   static bool supportsAvx2();
+   static bool supportsAvx512();
+   // the gather uses 32 bit offsets into the value table, larger instances have to use the scalar loop
+   static bool isApplicable(const int nVars);
+
+   static const char * getKernelName();
+
+ private:
+   static const Kernel kernel;
+
+   static Kernel selectKernel();
+};
+
+inline int LiteralSearch::findNonFalse(const Lit * lits, const int begin, const int end, const AssignState * state, const Lit skip)
+{
+   return kernel(lits, begin, end, state, skip);
+}
+
+inline int LiteralSearch::findScalar(const Lit * lits, int begin, const int end, const AssignState * state, const Lit skip)
+{
+   for (; begin < end; ++begin)
+      if (lits[begin] != skip && (state[var(lits[begin])].assign ^ sign(lits[begin])) != l_False)
+         break;
+   return begin;
+}
+
+} /* namespace Sticky */
+
+#endif /* SHARED_LITERALSEARCH_H_ */
@@ -80,7 +80,16 @@ LiteralSetting::LiteralSetting(const Glucose::SimpSolver & s, double randomSeed)
 //        polarity(s.nVars()),
         state(s.nVars()),
         activity(s.nVars()),
-        order_heap(VarOrderLt(activity))
+        order_heap(VarOrderLt(activity)),
+        branching(Branching::VSIDS),
+        vmtf(),
+        lrb(),
+        lrbStepSize(0),
+        original(),
+        target(s.nVars(), l_Undef),
+        best(s.nVars(), l_Undef),
+        targetSize(0),
+        bestSize(0)
 {
    assert(trail_lim.size() == 0);
    trail.capacity(s.nVars());
@@ -95,8 +104,110 @@ inline void LiteralSetting::rebuildOrderHeap()
    order_heap.build(vs);
 }
 
+void LiteralSetting::initBranching(const SolverHeuristic & h)
+{
+   branching = h.branching;
+   if (branching == Branching::VMTF)
+   {
+      // the most active variables are enqueued last and picked first
+      vec<Var> order(nVars());
+      for (Var v = 0; v < nVars(); ++v)
+         order[v] = v;
+      const vec<double> & act = activity;
+      sort(order, [&act](const Var a, const Var b)
+      {
+         return act[a] < act[b];
+      });
+      vmtf.init(order);
+      order_heap.clear();
+   } else if (branching == Branching::LRB)
+   {
+      lrb.growTo(nVars(), { 0, 0, 0 });
+      lrbStepSize = h.lrbStepSize;
+      // the random initial activities only break ties of the scores, scaling keeps the heap order
+      for (Var v = 0; v < nVars(); ++v)
+         activity[v] *= 1e-5;
+   }
+}
+
+void LiteralSetting::initPhases()
+{
+   original.growTo(nVars());
+   for (Var v = 0; v < nVars(); ++v)
+      original[v] = state[v].polarity;
+}
+
+// Called before backtracking from a conflict. The target phases only grow until the next
+// rephasing, the best phases during the whole search.
+//
+void LiteralSetting::updatePhases(const int consistent)
+{
+   if (consistent > targetSize)
+   {
+      for (int i = 0; i < consistent; ++i)
+         target[var(trail[i])] = lbool(sign(trail[i]));
+      targetSize = consistent;
+   }
+   if (consistent > bestSize)
+   {
+      for (int i = 0; i < consistent; ++i)
+         best[var(trail[i])] = lbool(sign(trail[i]));
+      bestSize = consistent;
+   }
+}
+
+void LiteralSetting::rephase(const char phase)
+{
+   for (Var v = 0; v < nVars(); ++v)
+   {
+      AssignState & s = state[v];
+      switch (phase)
+      {
+         case 'O':
+            s.polarity = original[v];
+            break;
+         case 'I':
+            s.polarity = !original[v];
+            break;
+         case 'B':
+            if (best[v] != l_Undef)
+               s.polarity = best[v] == l_True;
+            break;
+         case 'R':
+            s.polarity = rg.randBool();
+            break;
+         default:
+            ;
+      }
+      target[v] = l_Undef;
+   }
+   targetSize = 0;
+}
+
+void LiteralSetting::lrbUnassigned(const Var v, const uint64_t conflicts)
+{
+   const LrbState & s = lrb[v];
+   const uint64_t interval = conflicts - s.assigned;
+   if (interval > 0)
+   {
+      const double reward = static_cast<double>(s.participated + s.reasoned) / interval;
+      activity[v] = (1.0 - lrbStepSize) * activity[v] + lrbStepSize * reward;
+      if (order_heap.inHeap(v))
+         order_heap.update(v);
+   }
+}
+
 void LiteralSetting::varBumpActivity(const Var v, SolverHeuristic & h)
 {
+   if (branching == Branching::VMTF)
+   {
+      vmtf.bump(v);
+      return;
+   } else if (branching == Branching::LRB)
+   {
+      ++lrb[v].participated;
+      return;
+   }
    if ((activity[v] += h.var_inc) > 1e100)
    {
       // Rescale:
@@ -71,6 +71,7 @@ copies or substantial portions of the Software;
 #include "shared/Heuristic.h"
 #include "shared/Statistic.h"
 #include "shared/PropagateResult.h"
+#include "shared/VmtfQueue.h"
 #include "parallel_utils/RandomGenerator.h"
 #include "glucose/simp/SimpSolver.h"
 
@@ -109,6 +110,14 @@ struct AssignState
    }
 
 };
+// Counters of the learning rate branching for the current assignment of a variable
+struct LrbState
+{
+   uint64_t assigned;  // number of conflicts when the variable was assigned
+   uint32_t participated;  // conflicts the variable took part in since then
+   uint32_t reasoned;  // conflicts in which it was in the reason of a learnt clause literal
+};
+
 struct LiteralSetting
 {
    int qhead;
@@ -122,6 +131,15 @@ struct LiteralSetting
    vec<AssignState> state;
    vec<double> activity;  // A heuristic measurement of the activity of a variable.
    Heap<VarOrderLt> order_heap;  // A priority queue of variables ordered with respect to the variable activity.
+   Branching branching;  // decision order used by the search, taken from the heuristic in initBranching()
+   VmtfQueue vmtf;  // decision order of the VMTF branching, the order heap is empty then
+   vec<LrbState> lrb;  // the LRB branching orders the heap by the activity as learning rate score
+   double lrbStepSize;
+   vec<char> original;  // saved phases at the start of the search
+   vec<lbool> target;  // phases of the largest conflict free trail since the last rephasing, l_True is negative
+   vec<lbool> best;  // phases of the largest conflict free trail of the search
+   int targetSize;
+   int bestSize;
 
    LiteralSetting() = delete;
    LiteralSetting(const Glucose::SimpSolver & s, double randomSeed);
@@ -148,7 +166,17 @@ struct LiteralSetting
 
    // Main internal methods:
    //
+   void initBranching(const SolverHeuristic & h);  // Sets up the decision order of the heuristic from the current activities.
    void insertVarOrder(const Var x);  // Insert a variable in the decision order priority queue.
+   Var nextDecisionVar();  // The best unassigned variable, var_Undef if all are assigned.
+   bool preferredOver(const Var a, const Var b) const;  // True if 'a' comes before 'b' in the decision order.
+   void lrbAssigned(const Var v, const uint64_t conflicts);
+   void lrbUnassigned(const Var v, const uint64_t conflicts);  // Updates the score with the reward of the assignment.
+   void lrbReasoned(const Var v);
+   void initPhases();  // Takes the saved phases as original phases of the rephasing.
+   void updatePhases(const int consistent);  // The first 'consistent' literals of the trail cause no conflict.
+   void rephase(const char phase);  // Overwrites the saved phases and forgets the target phases.
+   bool decisionPolarity(const Var v, const bool useTarget) const;
    void newDecisionLevel();                     // Begins a new decision level.
    int decisionLevel() const;  // Gives the current decisionlevel.
 
@@ -252,13 +280,54 @@ inline int LiteralSetting::maxLevel(const BaseClause & c) const
 
 inline void LiteralSetting::insertVarOrder(const Var x)
 {
-   if (!order_heap.inHeap(x))
+   if (branching == Branching::VMTF)
+      vmtf.unassigned(x);
+   else if (!order_heap.inHeap(x))
       order_heap.insert(x);
 }
 
+inline Var LiteralSetting::nextDecisionVar()
+{
+   if (branching == Branching::VMTF)
+      return vmtf.next([this](const Var v)
+      {
+         return value(v) != l_Undef;
+      });
+   while (!order_heap.empty() && value(order_heap[0]) != l_Undef)
+      order_heap.removeMin();
+   return order_heap.empty() ? var_Undef : order_heap[0];
+}
+
+inline bool LiteralSetting::preferredOver(const Var a, const Var b) const
+{
+   return (branching == Branching::VMTF) ? vmtf.enqueuedAfter(a, b) : activity[a] > activity[b];
+}
+
+inline void LiteralSetting::lrbAssigned(const Var v, const uint64_t conflicts)
+{
+   lrb[v] = { conflicts, 0, 0 };
+}
+
+inline void LiteralSetting::lrbReasoned(const Var v)
+{
+   ++lrb[v].reasoned;
+}
+
 inline void LiteralSetting::varDecayActivity(SolverHeuristic & h)
 {
-   h.var_inc *= (1 / h.var_decay);
+   if (branching == Branching::VMTF)
+      vmtf.flushBumps();
+   else if (branching == Branching::LRB)
+   {
+      if (lrbStepSize > h.lrbMinStepSize)
+         lrbStepSize -= h.lrbStepDecay;
+   } else
+      h.var_inc *= (1 / h.var_decay);
+}
+
+inline bool LiteralSetting::decisionPolarity(const Var v, const bool useTarget) const
+{
+   return (useTarget && target[v] != l_Undef) ? target[v] == l_True : state[v].polarity;
 }
 
 inline void LiteralSetting::newDecisionLevel()
@@ -0,0 +1,246 @@
+/***************************************************************************************[Solver.cc]
+
+ Sticky Sat -- Copyright (c) 2018-2019, Marc Hartung, Zuse Institute Berlin
+
+Sticky Sat sources are based on Glucose Syrup and is therefore also restricted by all
+copyright notices below.
+
+Sticky Sat sources are based on another copyright. Permissions and copyrights for the parallel
+version of Glucose-Syrup (the "Software") are granted, free of charge, to deal with the Software
+without restriction, including the rights to use, copy, modify, merge, publish, distribute,
+sublicence, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+- The above and below copyrights notices and this permission notice shall be included in all
+copies or substantial portions of the Software;
+
+--------------- Original Glucose Copyrights
+
+ Glucose -- Copyright (c) 2009-2014, Gilles Audemard, Laurent Simon
+ CRIL - Univ. Artois, France
+ LRI  - Univ. Paris Sud, France (2009-2013)
+ Labri - Univ. Bordeaux, France
+
+ Syrup (Glucose Parallel) -- Copyright (c) 2013-2014, Gilles Audemard, Laurent Simon
+ CRIL - Univ. Artois, France
+ Labri - Univ. Bordeaux, France
+
+ Glucose sources are based on MiniSat (see below MiniSat copyrights). Permissions and copyrights of
+ Glucose (sources until 2013, Glucose 3.0, single core) are exactly the same as Minisat on which it
+ is based on. (see below).
+
+ Glucose-Syrup sources are based on another copyright. Permissions and copyrights for the parallel
+ version of Glucose-Syrup (the "Software") are granted, free of charge, to deal with the Software
+ without restriction, including the rights to use, copy, modify, merge, publish, distribute,
+ sublicence, and/or sell copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ - The above and below copyrights notices and this permission notice shall be included in all
+ copies or substantial portions of the Software;
+ - The parallel version of Glucose (all files modified since Glucose 3.0 releases, 2013) cannot
+ be used in any competitive event (sat competitions/evaluations) without the express permission of
+ the authors (Gilles Audemard / Laurent Simon). This is also the case for any competitive event
+ using Glucose Parallel as an embedded SAT engine (single core or not).
+
+
+ --------------- Original Minisat Copyrights
+
+ Copyright (c) 2003-2006, Niklas Een, Niklas Sorensson
+ Copyright (c) 2007-2010, Niklas Sorensson
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ associated documentation files (the "Software"), to deal in the Software without restriction,
+ including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or
+ substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ **************************************************************************************************/
+
+#include "shared/LocalSearch.h"
+
+#include <cmath>
+
+namespace Sticky
+{
+
+LocalSearch::LocalSearch(const int nVars)
+      : lits(),
+        clauseBegin(1, 0),
+        occBegin(),
+        occs(),
+        numTrue(),
+        falsified(),
+        falsifiedPos(),
+        signs(nVars, 0),
+        best(nVars, 0),
+        flipped(),
+        flippedOverflow(false),
+        breakProbs(),
+        scores(),
+        flips(0)
+{
+}
+
+void LocalSearch::addClause(const vec<Lit> & c)
+{
+   for (int i = 0; i < c.size(); ++i)
+      lits.push(c[i]);
+   clauseBegin.push(lits.size());
+}
+
+void LocalSearch::initOccurrences()
+{
+   const int numClauses = clauseBegin.size() - 1;
+   occBegin.growTo(2 * signs.size() + 1, 0);
+   for (int i = 0; i < lits.size(); ++i)
+      ++occBegin[toInt(lits[i]) + 1];
+   for (int i = 1; i < occBegin.size(); ++i)
+      occBegin[i] += occBegin[i - 1];
+   vec<int> pos;
+   occBegin.copyTo(pos);
+   occs.growTo(lits.size());
+   for (int c = 0; c < numClauses; ++c)
+      for (int i = clauseBegin[c]; i < clauseBegin[c + 1]; ++i)
+         occs[pos[toInt(lits[i])]++] = c;
+   numTrue.growTo(numClauses);
+   falsifiedPos.growTo(numClauses);
+}
+
+// Break count bases of ProbSAT by clause size, interpolated for the average size.
+//
+void LocalSearch::initBreakProbs()
+{
+   static const double sizes[] = { 0, 3, 4, 5, 6, 7 };
+   static const double bases[] = { 2.0, 2.5, 2.85, 3.7, 5.1, 7.4 };
+   const int numClauses = clauseBegin.size() - 1;
+   const double avgSize = (numClauses > 0) ? static_cast<double>(lits.size()) / numClauses : 0;
+   double base = bases[5];
+   for (int i = 1; i < 6; ++i)
+      if (avgSize <= sizes[i])
+      {
+         base = bases[i - 1] + (bases[i] - bases[i - 1]) * (avgSize - sizes[i - 1]) / (sizes[i] - sizes[i - 1]);
+         break;
+      }
+   for (double p = 1.0; p > 1e-300; p /= base)
+      breakProbs.push(p);
+}
+
+inline int LocalSearch::breakCount(const Var v) const
+{
+   const Lit t = mkLit(v, signs[v]);
+   int res = 0;
+   for (int i = occBegin[toInt(t)]; i < occBegin[toInt(t) + 1]; ++i)
+      res += numTrue[occs[i]] == 1;
+   return res;
+}
+
+void LocalSearch::flip(const Var v)
+{
+   const Lit t = mkLit(v, signs[v]);
+   signs[v] ^= 1;
+   for (int i = occBegin[toInt(t)]; i < occBegin[toInt(t) + 1]; ++i)
+   {
+      const int c = occs[i];
+      if (--numTrue[c] == 0)
+      {
+         falsifiedPos[c] = falsified.size();
+         falsified.push(c);
+      }
+   }
+   for (int i = occBegin[toInt(~t)]; i < occBegin[toInt(~t) + 1]; ++i)
+   {
+      const int c = occs[i];
+      if (numTrue[c]++ == 0)
+      {
+         const int last = falsified.last();
+         falsified[falsifiedPos[c]] = last;
+         falsifiedPos[last] = falsifiedPos[c];
+         falsified.pop();
+         falsifiedPos[c] = -1;
+      }
+   }
+   // the best assignment is only updated with the flips since it was reached, unless there are
+   // so many that copying the whole assignment is cheaper
+   if (!flippedOverflow)
+   {
+      if (flipped.size() < signs.size() / 4 + 16)
+         flipped.push(v);
+      else
+         flippedOverflow = true;
+   }
+}
+
+void LocalSearch::saveBest()
+{
+   if (flippedOverflow)
+      signs.copyTo(best);
+   else
+      for (int i = 0; i < flipped.size(); ++i)
+         best[flipped[i]] = signs[flipped[i]];
+   flipped.clear();
+   flippedOverflow = false;
+}
+
+int LocalSearch::walk(vec<char> & phases, const uint64_t maxFlips, RandomGenerator & rg)
+{
+   assert(phases.size() == signs.size());
+   if (occBegin.size() == 0)
+   {
+      initOccurrences();
+      initBreakProbs();
+   }
+   phases.copyTo(signs);
+   phases.copyTo(best);
+   flipped.clear();
+   flippedOverflow = false;
+   falsified.clear();
+   for (int c = 0; c < numTrue.size(); ++c)
+   {
+      numTrue[c] = 0;
+      for (int i = clauseBegin[c]; i < clauseBegin[c + 1]; ++i)
+         numTrue[c] += sign(lits[i]) == signs[var(lits[i])];
+      falsifiedPos[c] = -1;
+      if (numTrue[c] == 0)
+      {
+         falsifiedPos[c] = falsified.size();
+         falsified.push(c);
+      }
+   }
+
+   int bestFalsified = falsified.size();
+   for (uint64_t n = 0; n < maxFlips && falsified.size() > 0; ++n)
+   {
+      const int c = falsified[rg.rand(falsified.size())];
+      double sum = 0;
+      scores.clear();
+      for (int i = clauseBegin[c]; i < clauseBegin[c + 1]; ++i)
+      {
+         const int b = breakCount(var(lits[i]));
+         scores.push(breakProbs[std::min(b, breakProbs.size() - 1)]);
+         sum += scores.last();
+      }
+      double r = rg.rand01() * sum;
+      int i = 0;
+      while (i < scores.size() - 1 && r >= scores[i])
+         r -= scores[i++];
+      flip(var(lits[clauseBegin[c] + i]));
+      ++flips;
+      if (falsified.size() < bestFalsified)
+      {
+         bestFalsified = falsified.size();
+         saveBest();
+      }
+   }
+   best.copyTo(phases);
+   return bestFalsified;
+}
+
+} /* namespace Sticky */
@@ -0,0 +1,127 @@
+/***************************************************************************************[Solver.cc]
+
+ Sticky Sat -- Copyright (c) 2018-2019, Marc Hartung, Zuse Institute Berlin
+
+Sticky Sat sources are based on Glucose Syrup and is therefore also restricted by all
+copyright notices below.
+
+Sticky Sat sources are based on another copyright. Permissions and copyrights for the parallel
+version of Glucose-Syrup (the "Software") are granted, free of charge, to deal with the Software
+without restriction, including the rights to use, copy, modify, merge, publish, distribute,
+sublicence, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+- The above and below copyrights notices and this permission notice shall be included in all
+copies or substantial portions of the Software;
+
+--------------- Original Glucose Copyrights
+
+ Glucose -- Copyright (c) 2009-2014, Gilles Audemard, Laurent Simon
+ CRIL - Univ. Artois, France
+ LRI  - Univ. Paris Sud, France (2009-2013)
+ Labri - Univ. Bordeaux, France
+
+ Syrup (Glucose Parallel) -- Copyright (c) 2013-2014, Gilles Audemard, Laurent Simon
+ CRIL - Univ. Artois, France
+ Labri - Univ. Bordeaux, France
+
+ Glucose sources are based on MiniSat (see below MiniSat copyrights). Permissions and copyrights of
+ Glucose (sources until 2013, Glucose 3.0, single core) are exactly the same as Minisat on which it
+ is based on. (see below).
+
+ Glucose-Syrup sources are based on another copyright. Permissions and copyrights for the parallel
+ version of Glucose-Syrup (the "Software") are granted, free of charge, to deal with the Software
+ without restriction, including the rights to use, copy, modify, merge, publish, distribute,
+ sublicence, and/or sell copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ - The above and below copyrights notices and this permission notice shall be included in all
+ copies or substantial portions of the Software;
+ - The parallel version of Glucose (all files modified since Glucose 3.0 releases, 2013) cannot
+ be used in any competitive event (sat competitions/evaluations) without the express permission of
+ the authors (Gilles Audemard / Laurent Simon). This is also the case for any competitive event
+ using Glucose Parallel as an embedded SAT engine (single core or not).
+
+
+ --------------- Original Minisat Copyrights
+
+ Copyright (c) 2003-2006, Niklas Een, Niklas Sorensson
+ Copyright (c) 2007-2010, Niklas Sorensson
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ associated documentation files (the "Software"), to deal in the Software without restriction,
+ including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or
+ substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ **************************************************************************************************/
+
+#ifndef SHARED_LOCALSEARCH_H_
+#define SHARED_LOCALSEARCH_H_
+
+#include "shared/SharedTypes.h"
+#include "parallel_utils/RandomGenerator.h"
+
+namespace Sticky
+{
+
+/*
+ * ProbSAT local search on a fixed set of clauses. In every step a random falsified clause is
+ * picked and one of its variables is flipped with a probability that decreases exponentially with
+ * the number of clauses the flip would falsify (break count). The base of the exponent grows with
+ * the average clause size. The assignments are given as phases like the saved phases of the
+ * solver: true means the variable is assigned false.
+ */
+class LocalSearch
+{
+ public:
+   LocalSearch(const int nVars);
+
+   // the clause must not contain assigned literals
+   void addClause(const vec<Lit> & c);
+
+   // Walks from the given phases for at most maxFlips flips and replaces them with the best
+   // assignment found. Returns the number of clauses it falsifies.
+   int walk(vec<char> & phases, const uint64_t maxFlips, RandomGenerator & rg);
+
+   uint64_t getFlips() const;
+
+ private:
+   vec<Lit> lits;
+   vec<int> clauseBegin;  // literals of clause i are in [clauseBegin[i], clauseBegin[i+1])
+   vec<int> occBegin;  // clauses containing literal l are in [occBegin[l], occBegin[l+1])
+   vec<int> occs;
+   vec<int> numTrue;
+   vec<int> falsified;
+   vec<int> falsifiedPos;  // position of a clause in falsified, -1 if it is satisfied
+   vec<char> signs;  // current assignment
+   vec<char> best;
+   vec<Var> flipped;  // flips since the best assignment, used to update it
+   bool flippedOverflow;
+   vec<double> breakProbs;
+   vec<double> scores;
+   uint64_t flips;
+
+   void initOccurrences();
+   void initBreakProbs();
+   int breakCount(const Var v) const;
+   void flip(const Var v);
+   void saveBest();
+};
+
+inline uint64_t LocalSearch::getFlips() const
+{
+   return flips;
+}
+
+} /* namespace Sticky */
+
+#endif /* SHARED_LOCALSEARCH_H_ */
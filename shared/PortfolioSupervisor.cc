@@ -0,0 +1,191 @@
+/***************************************************************************************[Solver.cc]
+
+ Sticky Sat -- Copyright (c) 2018-2019, Marc Hartung, Zuse Institute Berlin
+
+Sticky Sat sources are based on Glucose Syrup and is therefore also restricted by all
+copyright notices below.
+
+Sticky Sat sources are based on another copyright. Permissions and copyrights for the parallel
+version of Glucose-Syrup (the "Software") are granted, free of charge, to deal with the Software
+without restriction, including the rights to use, copy, modify, merge, publish, distribute,
+sublicence, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+- The above and below copyrights notices and this permission notice shall be included in all
+copies or substantial portions of the Software;
+
+--------------- Original Glucose Copyrights
+
+ Glucose -- Copyright (c) 2009-2014, Gilles Audemard, Laurent Simon
+ CRIL - Univ. Artois, France
+ LRI  - Univ. Paris Sud, France (2009-2013)
+ Labri - Univ. Bordeaux, France
+
+ Syrup (Glucose Parallel) -- Copyright (c) 2013-2014, Gilles Audemard, Laurent Simon
+ CRIL - Univ. Artois, France
+ Labri - Univ. Bordeaux, France
+
+ Glucose sources are based on MiniSat (see below MiniSat copyrights). Permissions and copyrights of
+ Glucose (sources until 2013, Glucose 3.0, single core) are exactly the same as Minisat on which it
+ is based on. (see below).
+
+ Glucose-Syrup sources are based on another copyright. Permissions and copyrights for the parallel
+ version of Glucose-Syrup (the "Software") are granted, free of charge, to deal with the Software
+ without restriction, including the rights to use, copy, modify, merge, publish, distribute,
+ sublicence, and/or sell copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ - The above and below copyrights notices and this permission notice shall be included in all
+ copies or substantial portions of the Software;
+ - The parallel version of Glucose (all files modified since Glucose 3.0 releases, 2013) cannot
+ be used in any competitive event (sat competitions/evaluations) without the express permission of
+ the authors (Gilles Audemard / Laurent Simon). This is also the case for any competitive event
+ using Glucose Parallel as an embedded SAT engine (single core or not).
+
+
+ --------------- Original Minisat Copyrights
+
+ Copyright (c) 2003-2006, Niklas Een, Niklas Sorensson
+ Copyright (c) 2007-2010, Niklas Sorensson
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ associated documentation files (the "Software"), to deal in the Software without restriction,
+ including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or
+ substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ **************************************************************************************************/
+
+#include "shared/PortfolioSupervisor.h"
+#include "shared/CoreSolver.h"
+#include "shared/SolverConfiguration.h"
+
+#include <cmath>
+#include <limits>
+
+namespace Sticky
+{
+
+PortfolioSupervisor::PortfolioSupervisor(const vec<CoreSolver*> & solvers, const double interval)
+      : solvers(solvers),
+        timer(interval),
+        samples(),
+        scores(),
+        arms(SolverConfiguration::NumSettings * NumBranchings, Arm { 0, 0 })
+{
+}
+
+double PortfolioSupervisor::score(const CoreSolver & s, ThreadSample & sample, const double elapsed) const
+{
+   const SolverStatistic & stat = s.getStatistic();
+   const uint64_t conflicts = stat.nConflicts - sample.conflicts;
+   const uint64_t sumLbd = stat.sumLbd - sample.sumLbd;
+   const uint64_t exported = stat.nExportedCl - sample.exported;
+   sample.conflicts = stat.nConflicts;
+   sample.sumLbd = stat.sumLbd;
+   sample.exported = stat.nExportedCl;
+   if (conflicts == 0 || elapsed <= 0)
+      return 0;
+
+   const double avgLbd = std::max(1.0, static_cast<double>(sumLbd) / conflicts);
+   return (conflicts / elapsed) / avgLbd * (1.0 + static_cast<double>(exported) / conflicts);
+}
+
+unsigned PortfolioSupervisor::armIndex(const unsigned setting, const Branching branching)
+{
+   static_assert(static_cast<unsigned>(Branching::LRB) + 1 == NumBranchings, "Every branching needs its arms");
+   return setting * NumBranchings + static_cast<unsigned>(branching);
+}
+
+unsigned PortfolioSupervisor::bestSetting(const Branching branching) const
+{
+   uint64_t numPulls = 0;
+   for (unsigned i = 0; i < SolverConfiguration::NumSettings; ++i)
+      numPulls += arms[armIndex(i, branching)].pulls;
+
+   unsigned best = 0;
+   double bestValue = -1;
+   for (unsigned i = 0; i < SolverConfiguration::NumSettings; ++i)
+   {
+      const Arm & arm = arms[armIndex(i, branching)];
+      // untried settings are explored first
+      const double value =
+            (arm.pulls == 0) ? std::numeric_limits<double>::max() : arm.rewards / arm.pulls + std::sqrt(2.0 * std::log(numPulls) / arm.pulls);
+      if (value > bestValue)
+      {
+         best = i;
+         bestValue = value;
+      }
+   }
+   return best;
+}
+
+void PortfolioSupervisor::update()
+{
+   if (!timer.isOver())
+      return;
+   const double elapsed = timer.getPassedTime();
+   timer.reset();
+   if (samples.size() != solvers.size())
+   {
+      samples.growTo(solvers.size(), ThreadSample { 0, 0, 0, 0, 0 });
+      scores.growTo(solvers.size(), 0);
+      for (int i = 0; i < solvers.size(); ++i)
+         samples[i].setting = solvers[i]->getSetting();
+   }
+
+   double maxScore = 0;
+   int numCandidates = 0;
+   for (int i = 0; i < solvers.size(); ++i)
+   {
+      ThreadSample & sample = samples[i];
+      scores[i] = score(*solvers[i], sample, elapsed);
+      // a solver switches on its next restart, the interval of the switch mixes both settings
+      const unsigned setting = solvers[i]->getSetting();
+      if (setting != sample.setting)
+      {
+         sample.setting = setting;
+         sample.intervals = 0;
+      } else
+         ++sample.intervals;
+      if (!solvers[i]->getHeuristic().walker)
+      {
+         maxScore = std::max(maxScore, scores[i]);
+         ++numCandidates;
+      }
+   }
+   if (numCandidates < 2 || maxScore <= 0)
+      return;
+
+   int weakest = -1;
+   for (int i = 0; i < solvers.size(); ++i)
+   {
+      const CoreSolver & s = *solvers[i];
+      if (s.getHeuristic().walker || samples[i].intervals == 0)
+         continue;
+      Arm & arm = arms[armIndex(samples[i].setting, s.getHeuristic().branching)];
+      arm.rewards += scores[i] / maxScore;
+      ++arm.pulls;
+      if (samples[i].intervals >= MinDwellIntervals && (weakest < 0 || scores[i] < scores[weakest]))
+         weakest = i;
+   }
+   if (weakest < 0)
+      return;
+   CoreSolver & s = *solvers[weakest];
+   const unsigned setting = bestSetting(s.getHeuristic().branching);
+   if (setting != samples[weakest].setting)
+   {
+      s.requestSetting(setting);
+      samples[weakest].intervals = 0;
+   }
+}
+
+} /* namespace Sticky */
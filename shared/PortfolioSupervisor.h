@@ -0,0 +1,129 @@
+/***************************************************************************************[Solver.cc]
+
+ Sticky Sat -- Copyright (c) 2018-2019, Marc Hartung, Zuse Institute Berlin
+
+Sticky Sat sources are based on Glucose Syrup and is therefore also restricted by all
+copyright notices below.
+
+Sticky Sat sources are based on another copyright. Permissions and copyrights for the parallel
+version of Glucose-Syrup (the "Software") are granted, free of charge, to deal with the Software
+without restriction, including the rights to use, copy, modify, merge, publish, distribute,
+sublicence, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+- The above and below copyrights notices and this permission notice shall be included in all
+copies or substantial portions of the Software;
+
+--------------- Original Glucose Copyrights
+
+ Glucose -- Copyright (c) 2009-2014, Gilles Audemard, Laurent Simon
+ CRIL - Univ. Artois, France
+ LRI  - Univ. Paris Sud, France (2009-2013)
+ Labri - Univ. Bordeaux, France
+
+ Syrup (Glucose Parallel) -- Copyright (c) 2013-2014, Gilles Audemard, Laurent Simon
+ CRIL - Univ. Artois, France
+ Labri - Univ. Bordeaux, France
+
+ Glucose sources are based on MiniSat (see below MiniSat copyrights). Permissions and copyrights of
+ Glucose (sources until 2013, Glucose 3.0, single core) are exactly the same as Minisat on which it
+ is based on. (see below).
+
+ Glucose-Syrup sources are based on another copyright. Permissions and copyrights for the parallel
+ version of Glucose-Syrup (the "Software") are granted, free of charge, to deal with the Software
+ without restriction, including the rights to use, copy, modify, merge, publish, distribute,
+ sublicence, and/or sell copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ - The above and below copyrights notices and this permission notice shall be included in all
+ copies or substantial portions of the Software;
+ - The parallel version of Glucose (all files modified since Glucose 3.0 releases, 2013) cannot
+ be used in any competitive event (sat competitions/evaluations) without the express permission of
+ the authors (Gilles Audemard / Laurent Simon). This is also the case for any competitive event
+ using Glucose Parallel as an embedded SAT engine (single core or not).
+
+
+ --------------- Original Minisat Copyrights
+
+ Copyright (c) 2003-2006, Niklas Een, Niklas Sorensson
+ Copyright (c) 2007-2010, Niklas Sorensson
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ associated documentation files (the "Software"), to deal in the Software without restriction,
+ including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or
+ substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ **************************************************************************************************/
+
+#ifndef SHARED_PORTFOLIOSUPERVISOR_H_
+#define SHARED_PORTFOLIOSUPERVISOR_H_
+
+#include "shared/SharedTypes.h"
+#include "shared/Heuristic.h"
+#include "parallel_utils/Timer.h"
+
+#include <cstdint>
+
+namespace Sticky
+{
+class CoreSolver;
+
+/*
+ * Moves weak solvers to promising settings of the SolverConfiguration while the search runs. Every
+ * interval each solver is scored by its conflicts per second divided by the average lbd of its
+ * learnt clauses and weighted by the fraction of exported clauses. The scores relative to the best
+ * solver are the rewards of a UCB1 bandit. A solver keeps its branching heuristic, so the arms are
+ * the pairs of setting and branching. The solver with the lowest score gets the setting with the
+ * highest upper confidence bound among the arms of its branching, if it does not already have it.
+ * A solver is only rewarded for whole intervals with its setting and only moved again after
+ * MinDwellIntervals of them. Local search workers keep their setting.
+ */
+class PortfolioSupervisor
+{
+ public:
+   PortfolioSupervisor(const vec<CoreSolver*> & solvers, const double interval);
+
+   // called periodically by the main thread, does nothing until the interval is over
+   void update();
+
+ private:
+   static const unsigned NumBranchings = 3;
+   static const unsigned MinDwellIntervals = 2;
+
+   struct ThreadSample
+   {
+      uint64_t conflicts;
+      uint64_t sumLbd;
+      uint64_t exported;
+      unsigned setting;
+      unsigned intervals;  // whole intervals the solver ran with the setting
+   };
+   struct Arm
+   {
+      double rewards;
+      uint64_t pulls;
+   };
+
+   const vec<CoreSolver*> & solvers;
+   Timer timer;
+   vec<ThreadSample> samples;
+   vec<double> scores;
+   vec<Arm> arms;
+
+   double score(const CoreSolver & s, ThreadSample & sample, const double elapsed) const;
+   static unsigned armIndex(const unsigned setting, const Branching branching);
+   unsigned bestSetting(const Branching branching) const;
+};
+
+} /* namespace Sticky */
+
+#endif /* SHARED_PORTFOLIOSUPERVISOR_H_ */
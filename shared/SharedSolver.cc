@@ -120,7 +120,8 @@ SharedSolver::SharedSolver()
         viviTimer(1),
         runTimer(buckets.getHeuristic().maxRuntime),
         initialSolver(new SimpSolver()),
-        globalStat(*this)
+        globalStat(*this),
+        supervisor(solvers, buckets.getHeuristic().reconfigureInterval)
 {
 }
 
@@ -172,6 +173,7 @@ void SharedSolver::run()
          checkVivifyComplete(globalStat);
          viviTimer.reset();
       }
+      supervisor.update();
       usleep(15);
    }
    if (!resourcesOk())
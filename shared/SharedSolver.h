@@ -69,6 +69,7 @@ copies or substantial portions of the Software;
 
 #include "shared/CoreSolver.h"
 #include "shared/ClauseDatabase.h"
+#include "shared/PortfolioSupervisor.h"
 #include "glucose/simp/SimpSolver.h"
 #include "parallel_utils/Timer.h"
 
@@ -119,6 +120,7 @@ class SharedSolver : public ClauseDatabase
    SimpSolver * initialSolver;
 
    GlobalStatistic globalStat;
+   PortfolioSupervisor supervisor;
 
    void printSolverStats();
    bool resourcesOk();
@@ -73,11 +73,54 @@ namespace Sticky
 void SolverConfiguration::configure(CoreSolver & s, unsigned solverId, unsigned numSolvers)
 {
    SolverHeuristic & h = s.getHeuristic();
-   unsigned setting = solverId % 8;
+   unsigned setting = solverId % NumSettings;
    double solverFactor = static_cast<double>(solverId + 1) / numSolvers;
-   double noisevar_decay = 0.005 * (solverId % 8);
    int noiseReduceDB = 50 * solverId;
 
+   applySetting(h, setting);
+   s.setting = setting;
+   s.requestedSetting = setting;
+   // two of eight settings decide with the move to front queue, two with the learning rate
+   if (h.portfolioBranching)
+   {
+      if (setting % 4 == 2)
+         h.branching = Branching::VMTF;
+      else if (setting == 4 || setting == 7)
+         h.branching = Branching::LRB;
+   }
+   // the last solvers work mainly as local search and share their best phases
+   const unsigned numWalkers = h.portfolioWalkers ? (numSolvers >= 8 ? 1 : 0) : h.numWalkers;
+   if (solverId + numWalkers >= numSolvers)
+   {
+      h.walker = true;
+      h.rephaseSchedule = "W";
+      if (h.rephaseInterval > 0)
+         h.rephaseInterval = std::max<uint64_t>(1, h.rephaseInterval / 4);
+   }
+   h.firstReduceDb *= 0.25 + (solverFactor * 1.75);
+   h.firstReduceDb += noiseReduceDB;
+   h.incReduceDB *= 0.25 + (solverFactor * 1.75);
+
+   //std::cout << "dc: " << h.var_decay << " fR: " << h.firstReduceDb << " iR: " << h.incReduceDB << " sLQ: " << h.sizeLBDQueue << " K: " << h.K << "\n";
+   //std::cout.flush();
+}
+
+void SolverConfiguration::reconfigure(CoreSolver & s, unsigned setting)
+{
+   SolverHeuristic & h = s.getHeuristic();
+   const SolverHeuristic defaults;
+   h.chanseok = defaults.chanseok;
+   h.luby = defaults.luby;
+   h.var_decay = defaults.var_decay;
+   h.max_var_decay = defaults.max_var_decay;
+   applySetting(h, setting);
+   s.setting = setting;
+}
+
+void SolverConfiguration::applySetting(SolverHeuristic & h, unsigned setting)
+{
+   double noisevar_decay = 0.005 * setting;
+
    switch (setting)
    {
       case (1):
@@ -117,12 +160,20 @@ void SolverConfiguration::configure(CoreSolver & s, unsigned solverId, unsigned
       default:
          ;
    }
+   // every second setting backtracks chronologically on long backjumps
+   h.chrono = (setting % 2 == 1) && h.chronoDistance >= 0;
+   // the settings without Luby restarts alternate with a stable search, except one pure focused
+   if (h.portfolioModeSwitch)
+      h.modeSwitch = !h.luby && setting != 1;
+   // a quarter of the settings keeps to the saved phases for diversity
+   if (h.portfolioTargetPhases)
+      h.targetPhases = setting % 4 != 3;
+   // the settings cycle through the phases in different orders
+   if (h.portfolioRephasing)
+   {
+      static const char * schedules[] = { "BWOBWI", "BSBOBR", "BIBWBS", "OBWBRB" };
+      h.rephaseSchedule = schedules[setting % 4];
+   }
    h.var_decay += noisevar_decay;
-   h.firstReduceDb *= 0.25 + (solverFactor * 1.75);
-   h.firstReduceDb += noiseReduceDB;
-   h.incReduceDB *= 0.25 + (solverFactor * 1.75);
-
-   //std::cout << "dc: " << h.var_decay << " fR: " << h.firstReduceDb << " iR: " << h.incReduceDB << " sLQ: " << h.sizeLBDQueue << " K: " << h.K << "\n";
-   //std::cout.flush();
 }
 }
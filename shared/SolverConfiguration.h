@@ -77,7 +77,15 @@ namespace Sticky
 class SolverConfiguration {
 
 public : 
+    static const unsigned NumSettings = 8;
+
     static void configure(CoreSolver & s, unsigned solverId, unsigned numSolvers);
+    // Replaces the restart, decay, reduce and phase parameters with the ones of another setting,
+    // the decision heuristic is kept. Only the solver itself may call it, at level 0.
+    static void reconfigure(CoreSolver & s, unsigned setting);
+
+private :
+    static void applySetting(SolverHeuristic & h, unsigned setting);
     
 };
 
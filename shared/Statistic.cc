@@ -81,7 +81,6 @@ namespace Sticky
 
 SolverStatistic::SolverStatistic()
       : medianLbd(std::min(SharingHeuristic().maxSharedLBD, SharingHeuristic().maxVivificationLbd)),
-        sumLbd(0),
         nLastReduceConflicts(0),
         nRestarts(1),
         nReduces(0),
@@ -89,10 +88,25 @@ SolverStatistic::SolverStatistic()
         nViviPropagations(0),
         nDecisions(0),
         nConflicts(0),
+        sumLbd(0),
         nVivifications(0),
         sumVivificationLength(0),
         sumViviStartLength(0),
         failedVivifycations(0),
+        nMinimizeCacheHits(0),
+        nMinimizeSavedLits(0),
+        nReusedTrails(0),
+        nReusedLevels(0),
+        nRecentSubsumed(0),
+        nRephases(0),
+        nModeSwitches(0),
+        nStableConflicts(0),
+        nStableRestarts(0),
+        nWalks(0),
+        nWalkFlips(0),
+        nReconfigurations(0),
+        gcMicros(0),
+        maxGcMicros(0),
         nUnit(0),
         nExportedCl(0),
         nImportedCl(0),
@@ -156,7 +170,21 @@ GlobalStatistic::GlobalStatistic(const ClauseDatabase & db)
         numAllocatedPermanentClauses("allocPermCl"),
         nVivifications("nVivs"),
         avgVivificationLength("avgLen%"),
-        failedVivifycations("fVivs")
+        failedVivifycations("fVivs"),
+        minimizeCacheHits("minHits"),
+        minimizeSavedLits("minSaved"),
+        reusedTrails("reuseTr"),
+        reusedLevels("reuseLvl"),
+        recentSubsumed("recSubs"),
+        rephases("rephases"),
+        modeSwitches("switches"),
+        stableConflicts("stableCfl"),
+        stableRestarts("stableRst"),
+        walks("walks"),
+        walkFlips("flips"),
+        reconfigurations("reconf"),
+        gcMicros("gcUs"),
+        maxGcMicros("maxGcUs")
 {
    static bool printedHeader = false;
    if (!human && !printedHeader)
@@ -202,6 +230,20 @@ void GlobalStatistic::update(const double & sysT)
    nVivifications.clear();
    avgVivificationLength.clear();
    failedVivifycations.clear();
+   minimizeCacheHits.clear();
+   minimizeSavedLits.clear();
+   reusedTrails.clear();
+   reusedLevels.clear();
+   recentSubsumed.clear();
+   rephases.clear();
+   modeSwitches.clear();
+   stableConflicts.clear();
+   stableRestarts.clear();
+   walks.clear();
+   walkFlips.clear();
+   reconfigurations.clear();
+   gcMicros.clear();
+   maxGcMicros.clear();
 
    for (unsigned i = 0; i < db.getNumSolverThreads(); ++i)
    {
@@ -226,6 +268,20 @@ void GlobalStatistic::update(const double & sysT)
       nVivifications.add(stat.nVivifications);
       avgVivificationLength.add(100.0 * static_cast<double>(stat.sumVivificationLength) / static_cast<double>(std::max(1lu, stat.sumViviStartLength.load())));
       failedVivifycations.add(stat.failedVivifycations);
+      minimizeCacheHits.add(stat.nMinimizeCacheHits);
+      minimizeSavedLits.add(stat.nMinimizeSavedLits);
+      reusedTrails.add(stat.nReusedTrails);
+      reusedLevels.add(stat.nReusedLevels);
+      recentSubsumed.add(stat.nRecentSubsumed);
+      rephases.add(stat.nRephases);
+      modeSwitches.add(stat.nModeSwitches);
+      stableConflicts.add(stat.nStableConflicts);
+      stableRestarts.add(stat.nStableRestarts);
+      walks.add(stat.nWalks);
+      walkFlips.add(stat.nWalkFlips);
+      reconfigurations.add(stat.nReconfigurations);
+      gcMicros.add(stat.gcMicros);
+      maxGcMicros.add(stat.maxGcMicros);
    }
    uint64_t numAllocCl = numAllocatedPrivateClauses.sum() + numAllocatedSharedClauses.sum() + numAllocatedPermanentClauses.sum();
 
@@ -253,7 +309,9 @@ void GlobalStatistic::printInterval() const
    if (human)
    {
       auto mPrinter = makeMultiSamplePrinter(numRestarts, numReduces, numConflicts, numPropagations, numViviPropagations, numExported, numPromoted, numPrivateClauses,
-                                             numSharedClauses, numTwoWatchedClauses, numOneWatchedClauses, nVivifications, failedVivifycations, avgVivificationLength, averageLbd);
+                                             numSharedClauses, numTwoWatchedClauses, numOneWatchedClauses, nVivifications, failedVivifycations, avgVivificationLength, averageLbd, minimizeCacheHits, minimizeSavedLits,
+                                             reusedTrails, reusedLevels, recentSubsumed, rephases, modeSwitches,
+                                             stableConflicts, stableRestarts, walks, walkFlips, reconfigurations, gcMicros, maxGcMicros);
       mPrinter.printLine();
       mPrinter.printNames();
       mPrinter.printLine();
@@ -86,7 +86,6 @@ struct SolverStatistic
 {
 
    uint32_t medianLbd;
-   uint64_t sumLbd;
    uint64_t nLastReduceConflicts;
    std::atomic<uint64_t> nRestarts;
    std::atomic<uint64_t> nReduces;
@@ -94,10 +93,25 @@ struct SolverStatistic
    std::atomic<uint64_t> nViviPropagations;
    std::atomic<uint64_t> nDecisions;
    std::atomic<uint64_t> nConflicts;
+   std::atomic<uint64_t> sumLbd;  // sum of the lbds of all learnt clauses
    std::atomic<uint64_t> nVivifications;
    std::atomic<uint64_t> sumVivificationLength;
    std::atomic<uint64_t> sumViviStartLength;
    std::atomic<uint64_t> failedVivifycations;
+   std::atomic<uint64_t> nMinimizeCacheHits;
+   std::atomic<uint64_t> nMinimizeSavedLits;  // reason literals of cached literals that were not visited again
+   std::atomic<uint64_t> nReusedTrails;
+   std::atomic<uint64_t> nReusedLevels;
+   std::atomic<uint64_t> nRecentSubsumed;
+   std::atomic<uint64_t> nRephases;
+   std::atomic<uint64_t> nModeSwitches;
+   std::atomic<uint64_t> nStableConflicts;
+   std::atomic<uint64_t> nStableRestarts;
+   std::atomic<uint64_t> nWalks;
+   std::atomic<uint64_t> nWalkFlips;
+   std::atomic<uint64_t> nReconfigurations;
+   std::atomic<uint64_t> gcMicros;  // time spent in garbage collections
+   std::atomic<uint64_t> maxGcMicros;  // longest garbage collection pause
    std::atomic<uint64_t> nUnit;
    std::atomic<uint64_t> nExportedCl;
    std::atomic<uint64_t> nImportedCl;
@@ -169,6 +183,20 @@ struct GlobalStatistic
    MultiSample<uint64_t> nVivifications;
    MultiSample<double> avgVivificationLength;
    MultiSample<uint64_t> failedVivifycations;
+   MultiSample<uint64_t> minimizeCacheHits;
+   MultiSample<uint64_t> minimizeSavedLits;
+   MultiSample<uint64_t> reusedTrails;
+   MultiSample<uint64_t> reusedLevels;
+   MultiSample<uint64_t> recentSubsumed;
+   MultiSample<uint64_t> rephases;
+   MultiSample<uint64_t> modeSwitches;
+   MultiSample<uint64_t> stableConflicts;
+   MultiSample<uint64_t> stableRestarts;
+   MultiSample<uint64_t> walks;
+   MultiSample<uint64_t> walkFlips;
+   MultiSample<uint64_t> reconfigurations;
+   MultiSample<uint64_t> gcMicros;
+   MultiSample<uint64_t> maxGcMicros;
 
    GlobalStatistic(const ClauseDatabase & db);
 
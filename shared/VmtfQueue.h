@@ -0,0 +1,145 @@
+/***************************************************************************************[Solver.cc]
+
+ Sticky Sat -- Copyright (c) 2018-2019, Marc Hartung, Zuse Institute Berlin
+
+Sticky Sat sources are based on Glucose Syrup and is therefore also restricted by all
+copyright notices below.
+
+Sticky Sat sources are based on another copyright. Permissions and copyrights for the parallel
+version of Glucose-Syrup (the "Software") are granted, free of charge, to deal with the Software
+without restriction, including the rights to use, copy, modify, merge, publish, distribute,
+sublicence, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+- The above and below copyrights notices and this permission notice shall be included in all
+copies or substantial portions of the Software;
+
+--------------- Original Glucose Copyrights
+
+ Glucose -- Copyright (c) 2009-2014, Gilles Audemard, Laurent Simon
+ CRIL - Univ. Artois, France
+ LRI  - Univ. Paris Sud, France (2009-2013)
+ Labri - Univ. Bordeaux, France
+
+ Syrup (Glucose Parallel) -- Copyright (c) 2013-2014, Gilles Audemard, Laurent Simon
+ CRIL - Univ. Artois, France
+ Labri - Univ. Bordeaux, France
+
+ Glucose sources are based on MiniSat (see below MiniSat copyrights). Permissions and copyrights of
+ Glucose (sources until 2013, Glucose 3.0, single core) are exactly the same as Minisat on which it
+ is based on. (see below).
+
+ Glucose-Syrup sources are based on another copyright. Permissions and copyrights for the parallel
+ version of Glucose-Syrup (the "Software") are granted, free of charge, to deal with the Software
+ without restriction, including the rights to use, copy, modify, merge, publish, distribute,
+ sublicence, and/or sell copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ - The above and below copyrights notices and this permission notice shall be included in all
+ copies or substantial portions of the Software;
+ - The parallel version of Glucose (all files modified since Glucose 3.0 releases, 2013) cannot
+ be used in any competitive event (sat competitions/evaluations) without the express permission of
+ the authors (Gilles Audemard / Laurent Simon). This is also the case for any competitive event
+ using Glucose Parallel as an embedded SAT engine (single core or not).
+
+
+ --------------- Original Minisat Copyrights
+
+ Copyright (c) 2003-2006, Niklas Een, Niklas Sorensson
+ Copyright (c) 2007-2010, Niklas Sorensson
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ associated documentation files (the "Software"), to deal in the Software without restriction,
+ including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or
+ substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ **************************************************************************************************/
+
+#ifndef SHARED_VMTFQUEUE_H_
+#define SHARED_VMTFQUEUE_H_
+
+#include "shared/SharedTypes.h"
+
+namespace Sticky
+{
+
+/*
+ * Decision queue of the variable move to front heuristic. The variables are kept in a doubly
+ * linked list ordered by the time they were enqueued, the last one is the most recently bumped.
+ * Bumped variables are collected during the conflict analysis and moved to the end in the order of
+ * their old enqueue time. The cursor points to a variable such that all later ones are assigned.
+ */
+class VmtfQueue
+{
+ public:
+   VmtfQueue();
+
+   // enqueues the variables in the given order, the last one is picked first
+   void init(const vec<Var> & order);
+
+   void bump(const Var v);
+   // moves the bumped variables to the end of the queue
+   void flushBumps();
+
+   // called when v is unassigned
+   void unassigned(const Var v);
+
+   // the most recently enqueued unassigned variable, var_Undef if all are assigned
+   template<typename IsAssigned>
+   Var next(const IsAssigned & isAssigned);
+
+   bool enqueuedAfter(const Var a, const Var b) const;
+
+ private:
+   struct Link
+   {
+      Var prev;
+      Var next;
+   };
+   vec<Link> links;
+   vec<uint64_t> stamps;
+   vec<Var> bumped;
+   Var first;
+   Var last;
+   Var cursor;
+   uint64_t stamp;
+
+   void moveToEnd(const Var v);
+};
+
+inline void VmtfQueue::bump(const Var v)
+{
+   bumped.push(v);
+}
+
+inline void VmtfQueue::unassigned(const Var v)
+{
+   if (cursor == var_Undef || stamps[v] > stamps[cursor])
+      cursor = v;
+}
+
+template<typename IsAssigned>
+inline Var VmtfQueue::next(const IsAssigned & isAssigned)
+{
+   while (cursor != var_Undef && isAssigned(cursor))
+      cursor = links[cursor].prev;
+   return cursor;
+}
+
+inline bool VmtfQueue::enqueuedAfter(const Var a, const Var b) const
+{
+   return stamps[a] > stamps[b];
+}
+
+} /* namespace Sticky */
+
+#endif /* SHARED_VMTFQUEUE_H_ */